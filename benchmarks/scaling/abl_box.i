@@ -0,0 +1,117 @@
+# Neutral atmospheric boundary layer box: Smagorinsky LES, periodic in x
+# and z, wall function at the ground (y=0), symmetry at the top, driven by
+# a constant body force. @MESH@ is set by run_scaling.sh
+
+Simulations:
+  - name: sim1
+    time_integrator: ti_1
+    optimizer: opt1
+
+linear_solvers:
+
+  - name: solve_scalar
+    type: tpetra
+    method: gmres
+    preconditioner: sgs
+    tolerance: 1e-5
+    max_iterations: 50
+    kspace: 50
+    output_level: 0
+
+  - name: solve_cont
+    type: tpetra
+    method: gmres
+    preconditioner: muelu
+    tolerance: 1e-5
+    max_iterations: 50
+    kspace: 50
+    output_level: 0
+
+realms:
+
+  - name: realm_1
+    mesh: "@MESH@"
+    mesh_type: generated
+    use_edges: yes
+    automatic_decomposition_type: rcb
+    write_timing_summary: yes
+
+    equation_systems:
+      name: theEqSys
+      max_iterations: 2
+
+      solver_system_specification:
+        velocity: solve_scalar
+        pressure: solve_cont
+
+      systems:
+        - LowMachEOM:
+            name: myLowMach
+            max_iterations: 1
+            convergence_tolerance: 1e-5
+
+    initial_conditions:
+      - constant: ic_1
+        target_name: block_1
+        value:
+          pressure: 0.0
+          velocity: [8.0, 0.0, 0.0]
+
+    material_properties:
+      target_name: block_1
+      specifications:
+        - name: density
+          type: constant
+          value: 1.18
+        - name: viscosity
+          type: constant
+          value: 1.8e-5
+
+    boundary_conditions:
+
+    - periodic_boundary_condition: bc_x
+      target_name: [surface_1, surface_2]
+      periodic_user_data:
+        search_tolerance: 1.e-3
+
+    - wall_boundary_condition: bc_ground
+      target_name: surface_3
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+        use_wall_function: yes
+
+    - symmetry_boundary_condition: bc_top
+      target_name: surface_4
+      symmetry_user_data:
+
+    - periodic_boundary_condition: bc_z
+      target_name: [surface_5, surface_6]
+      periodic_user_data:
+        search_tolerance: 1.e-3
+
+    solution_options:
+      name: myOptions
+      turbulence_model: smagorinsky
+
+      options:
+        - hybrid_factor:
+            velocity: 0.0
+
+        - source_terms:
+            momentum: body_force
+
+        - source_term_parameters:
+            momentum: [1.0e-4, 0.0, 0.0]
+
+Time_Integrators:
+  - StandardTimeIntegrator:
+      name: ti_1
+      start_time: 0
+      termination_step_count: 20
+      time_step: 0.5
+      time_stepping_type: fixed
+      time_step_count: 0
+      second_order_accuracy: yes
+
+      realms:
+        - realm_1
@@ -0,0 +1,144 @@
+# Differentially heated cavity: Boussinesq buoyancy, hot and cold side
+# walls, adiabatic elsewhere. @MESH@ is set by run_scaling.sh
+
+Simulations:
+  - name: sim1
+    time_integrator: ti_1
+    optimizer: opt1
+
+linear_solvers:
+
+  - name: solve_scalar
+    type: tpetra
+    method: gmres
+    preconditioner: sgs
+    tolerance: 1e-5
+    max_iterations: 50
+    kspace: 50
+    output_level: 0
+
+  - name: solve_cont
+    type: tpetra
+    method: gmres
+    preconditioner: muelu
+    tolerance: 1e-5
+    max_iterations: 50
+    kspace: 50
+    output_level: 0
+
+realms:
+
+  - name: realm_1
+    mesh: "@MESH@"
+    mesh_type: generated
+    use_edges: yes
+    automatic_decomposition_type: rcb
+    write_timing_summary: yes
+
+    equation_systems:
+      name: theEqSys
+      max_iterations: 2
+
+      solver_system_specification:
+        velocity: solve_scalar
+        enthalpy: solve_scalar
+        pressure: solve_cont
+
+      systems:
+        - LowMachEOM:
+            name: myLowMach
+            max_iterations: 1
+            convergence_tolerance: 1e-5
+
+        - Enthalpy:
+            name: myEnth
+            max_iterations: 1
+            convergence_tolerance: 1e-5
+
+    initial_conditions:
+      - constant: ic_1
+        target_name: block_1
+        value:
+          pressure: 0.0
+          velocity: [0.0, 0.0, 0.0]
+          temperature: 300.0
+
+    material_properties:
+      target_name: block_1
+      specifications:
+        - name: density
+          type: constant
+          value: 1.0
+        - name: viscosity
+          type: constant
+          value: 1.0e-3
+        - name: specific_heat
+          type: constant
+          value: 1000.0
+
+    boundary_conditions:
+
+    - wall_boundary_condition: bc_hot
+      target_name: surface_1
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+        temperature: 310.0
+
+    - wall_boundary_condition: bc_cold
+      target_name: surface_2
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+        temperature: 290.0
+
+    - wall_boundary_condition: bc_bottom
+      target_name: surface_3
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+
+    - wall_boundary_condition: bc_top
+      target_name: surface_4
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+
+    - wall_boundary_condition: bc_back
+      target_name: surface_5
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+
+    - wall_boundary_condition: bc_front
+      target_name: surface_6
+      wall_user_data:
+        velocity: [0.0, 0.0, 0.0]
+
+    solution_options:
+      name: myOptions
+
+      options:
+        - hybrid_factor:
+            velocity: 0.0
+            enthalpy: 1.0
+
+        - laminar_prandtl:
+            enthalpy: 0.71
+
+        - source_terms:
+            momentum: buoyancy_boussinesq
+
+        - user_constants:
+            gravity: [0.0, -9.81, 0.0]
+            reference_density: 1.0
+            reference_temperature: 300.0
+            thermal_expansion_coefficient: 3.33e-3
+
+Time_Integrators:
+  - StandardTimeIntegrator:
+      name: ti_1
+      start_time: 0
+      termination_step_count: 20
+      time_step: 0.01
+      time_stepping_type: fixed
+      time_step_count: 0
+      second_order_accuracy: yes
+
+      realms:
+        - realm_1
@@ -0,0 +1,98 @@
+#!/bin/bash
+#
+# Weak- and strong-scaling runs of the reference problems in this directory
+# on generated box meshes. Each run writes realm_1.timing_summary.json (json
+# lines, see write_timing_summary); the last overview of every run is
+# collected, tagged with case/mode/nprocs, into results/summary.jsonl
+#
+# usage: run_scaling.sh [-x naluX] [-l "mpirun -np"] [-n "1 2 4 8"]
+#                       [-w weak|strong] [-p milestone.xml] [case ...]
+#
+# cases: channel_les heated_cavity abl_box (default: all)
+#
+
+naluExe=naluX
+launcher="mpirun -np"
+rankCounts="1 2 4 8"
+mode=weak
+mueluXml=
+
+while getopts "x:l:n:w:p:h" opt; do
+  case $opt in
+    x) naluExe=$OPTARG ;;
+    l) launcher=$OPTARG ;;
+    n) rankCounts=$OPTARG ;;
+    w) mode=$OPTARG ;;
+    p) mueluXml=$OPTARG ;;
+    *) sed -n '3,13p' $0; exit 1 ;;
+  esac
+done
+shift $((OPTIND-1))
+
+cases="$@"
+if [ -z "$cases" ]; then
+  cases="channel_les heated_cavity abl_box"
+fi
+
+if [ "$mode" != "weak" ] && [ "$mode" != "strong" ]; then
+  echo "mode must be weak or strong, not $mode"
+  exit 1
+fi
+
+scriptDir=$(cd $(dirname $0) && pwd)
+resultsDir=$(pwd)/results
+mkdir -p $resultsDir
+
+# base elements (nx ny nz) and box (lx ly lz) on one rank; weak scaling
+# stretches x with the rank count, strong scaling uses the strong size
+case_size() {
+  case $1 in
+    channel_les)   echo "64 32 32 6.283185 2.0 3.141593" ;;
+    heated_cavity) echo "48 48 48 1.0 1.0 1.0" ;;
+    abl_box)       echo "48 24 48 3000.0 1000.0 3000.0" ;;
+    *) echo "" ;;
+  esac
+}
+strongFactor=4
+
+for theCase in $cases; do
+  size=$(case_size $theCase)
+  if [ -z "$size" ]; then
+    echo "unknown case $theCase"
+    exit 1
+  fi
+  set -- $size
+  nx=$1; ny=$2; nz=$3; lx=$4; ly=$5; lz=$6
+
+  for np in $rankCounts; do
+    if [ "$mode" == "weak" ]; then
+      mx=$((nx*np)); my=$ny; mz=$nz
+      bx=$(echo "$lx*$np" | bc -l)
+    else
+      mx=$((nx*strongFactor)); my=$ny; mz=$nz
+      bx=$(echo "$lx*$strongFactor" | bc -l)
+    fi
+    mesh="${mx}x${my}x${mz}|bbox:0,0,0,${bx},${ly},${lz}|sideset:xXyYzZ"
+
+    runDir=$resultsDir/${theCase}_${mode}_np${np}
+    rm -rf $runDir
+    mkdir -p $runDir
+    sed -e "s/@MESH@/${mesh}/" $scriptDir/$theCase.i > $runDir/$theCase.i
+    if [ -n "$mueluXml" ]; then
+      cp $mueluXml $runDir/milestone.xml
+    else
+      sed -i -e "s/preconditioner: muelu/preconditioner: sgs/" $runDir/$theCase.i
+    fi
+
+    echo "$theCase: $mode, $np ranks, mesh $mesh"
+    (cd $runDir && $launcher $np $naluExe -i $theCase.i -o $theCase.log)
+    if [ $? -ne 0 ] || [ ! -f $runDir/realm_1.timing_summary.json ]; then
+      echo "$theCase on $np ranks failed; see $runDir/$theCase.log"
+      continue
+    fi
+
+    tail -n 1 $runDir/realm_1.timing_summary.json \
+      | sed -e "s/^{/{\"case\": \"$theCase\", \"mode\": \"$mode\", \"elements\": $((mx*my*mz)), /" \
+      >> $resultsDir/summary.jsonl
+  done
+done
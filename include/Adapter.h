@@ -11,6 +11,9 @@
 #define Adapter_h
 
 #include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <set>
 
 namespace percept {
   class PerceptMesh;
@@ -43,6 +46,14 @@ public:
   void do_adapt(int what_to_do);
   void do_uniform_refine();
 
+  // global number of active elements marked for refinement or unrefinement
+  size_t marked_element_count();
+
+  // bracket a refine/unrefine pass to count the elements that came and
+  // went; the rebuild after a pass that changed the mesh is still global
+  void begin_change_tracking();
+  void end_change_tracking();
+
   const Realm& realm_;
   percept::UniformRefinerPatternBase *uniformRefinementPattern_;
   percept::UniformRefinerPatternBase *refinementPattern_;
@@ -54,6 +65,11 @@ public:
   // mesh verifier
   percept::AdaptedMeshVerifier * adaptedMeshVerifier_;
 
+  // locally owned element ids before the tracked pass; global counts after
+  std::set<stk::mesh::EntityId> priorElementIds_;
+  size_t numElementsCreated_;
+  size_t numElementsDestroyed_;
+
  private:
   void setNaluGlobalId();
 };
@@ -9,13 +9,18 @@
 #ifndef Algorithm_h
 #define Algorithm_h
 
+#include <string>
 #include <vector>
 
 namespace stk {
 namespace mesh {
+class FieldBase;
 class Part;
 typedef std::vector<Part*> PartVector;
 }
+namespace diag {
+class Timer;
+}
 }
 namespace sierra{
 namespace nalu{
@@ -44,9 +49,21 @@ public:
 
   virtual void pre_work() {}
 
+  // fields read and written by execute; false when the set is not known,
+  // in which case a task scheduler must order the algorithm against all others
+  virtual bool field_dependencies(
+    std::vector<stk::mesh::FieldBase *> &reads,
+    std::vector<stk::mesh::FieldBase *> &writes) const { return false; }
+
   Realm &realm_;
   stk::mesh::PartVector partVec_;
   std::vector<SupplementalAlgorithm *> supplementalAlg_;
+
+  // set on first execute; owned by the realm AlgorithmTimers
+  stk::diag::Timer *timer_;
+
+  // group/class name of the timer; hardware counter region
+  std::string regionName_;
 };
 
 } // namespace nalu
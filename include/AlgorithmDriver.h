@@ -12,6 +12,7 @@
 #include<Enums.h>
 
 #include<map>
+#include<string>
 
 namespace sierra{
 namespace nalu{
@@ -31,8 +32,12 @@ public:
   virtual void execute();
   virtual void post_work(){};
 
+  // name of the timer group; defaults to the driver class name
+  const std::string &timer_name();
+
   Realm &realm_;
   std::map<AlgorithmType, Algorithm *> algMap_;
+  std::string timerName_;
 };
 
 } // namespace nalu
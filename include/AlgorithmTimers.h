@@ -0,0 +1,107 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AlgorithmTimers_h
+#define AlgorithmTimers_h
+
+#include <stk_util/diag/Timer.hpp>
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+class Algorithm;
+
+// named stk::diag timers for every driver and algorithm of a realm; the
+// hierarchy is Nalu/Algorithms:realm/group/algorithm, where the group is an
+// equation system or algorithm driver. Timers are created on first use
+class AlgorithmTimers
+{
+public:
+
+  AlgorithmTimers(
+    Realm &realm);
+  ~AlgorithmTimers();
+
+  // timer for a group of algorithms
+  stk::diag::Timer &group_timer(
+    const std::string &groupName);
+
+  // timer for an algorithm within its group; cached on the algorithm
+  stk::diag::Timer &algorithm_timer(
+    const std::string &groupName,
+    Algorithm &alg);
+
+  // demangled class name without the nalu namespace
+  static std::string class_name(
+    const std::type_info &type);
+
+  // min/max/avg (over ranks) of the accumulated wall time
+  void dump_summary();
+
+  // one json object per call holding the wall time since the previous call
+  void dump_trace(
+    const int stepCount,
+    const double currentTime);
+
+private:
+
+  struct TimerEntry {
+    TimerEntry(
+      const std::string &groupName,
+      const std::string &name,
+      const stk::diag::Timer &timer)
+      : groupName_(groupName), name_(name), timer_(timer), lastTrace_(0.0) {}
+    std::string groupName_;
+    std::string name_;
+    stk::diag::Timer timer_;
+    double lastTrace_;
+  };
+
+  stk::diag::Timer &realm_timer();
+
+  stk::diag::Timer &find_or_create(
+    const std::string &groupName,
+    const std::string &name,
+    stk::diag::Timer &parent);
+
+  // collective; adds the timers any rank created since the last call to
+  // globalTimers_
+  void synchronize_timer_names();
+
+  // localTime is in the order of globalTimers_
+  void reduce(
+    std::vector<double> &localTime,
+    std::vector<double> &g_min,
+    std::vector<double> &g_max,
+    std::vector<double> &g_avg);
+
+  Realm &realm_;
+  stk::diag::Timer *realmTimer_;
+
+  // keyed by "group" for group timers and "group/name" for algorithms so
+  // that an algorithm follows its group when iterated
+  std::map<std::string, TimerEntry> timers_;
+
+  // union of the timer keys of all ranks, mapped to (group, name); ranks
+  // differ, e.g., when an algorithm has no entities on some of them
+  std::map<std::string, std::pair<std::string, std::string> > globalTimers_;
+
+  std::ofstream traceFile_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
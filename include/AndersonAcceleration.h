@@ -0,0 +1,80 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AndersonAcceleration_h
+#define AndersonAcceleration_h
+
+#include <string>
+#include <vector>
+
+namespace stk{
+namespace mesh{
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// Anderson acceleration of the outer (Picard) iteration over the equation
+// systems. One sweep of the systems maps the stacked nodal solution x to
+// G(x); the next iterate combines the last depth+1 sweeps so that the
+// least squares residual G(x)-x is smallest, rather than taking G(x). Each
+// field's part of the inner products is scaled by its mean square value at
+// the start of the time step
+class AndersonAcceleration
+{
+public:
+
+  AndersonAcceleration(
+    Realm &realm,
+    const std::vector<std::string> &fieldNames,
+    const int depth,
+    const double relaxation,
+    const double regularization);
+  ~AndersonAcceleration();
+
+  // first iteration of a time step: the history is dropped and the fields
+  // are the iterate
+  void begin();
+
+  // after a sweep: the fields hold G(x) and are replaced by the next iterate
+  void accelerate();
+
+private:
+
+  void gather(std::vector<double> &values);
+  void scatter(const std::vector<double> &values);
+
+  Realm &realm_;
+  const std::vector<std::string> fieldNames_;
+  const int depth_;
+  const double relaxation_;
+  const double regularization_;
+
+  std::vector<stk::mesh::FieldBase *> fields_;
+
+  // inner product weight of each entry; zero for the ones not owned
+  std::vector<double> weights_;
+
+  // current and previous iterate, previous residual and the differences of
+  // successive iterates and residuals, oldest first
+  std::vector<double> x_, xPrev_, fPrev_;
+  std::vector<std::vector<double> > dX_, dF_;
+  bool hasPrevious_;
+
+  // scratch
+  std::vector<double> g_, f_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -11,6 +11,7 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<DeviceEdgeAssembly.h>
 
 namespace stk {
 namespace mesh {
@@ -35,6 +36,12 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // edge kernel in the Kokkos execution space; false falls back to execute
+  bool execute_device(
+    const double projTimeScale,
+    const double interpTogether,
+    const double nocFac);
+
   const bool meshMotion_;
   
   VectorFieldType *velocityRTM_;
@@ -43,6 +50,10 @@ public:
   ScalarFieldType *pressure_;
   ScalarFieldType *density_;
   VectorFieldType *edgeAreaVec_;
+
+  // device copies for use_device_edge_assembly
+  DeviceEdgeData deviceData_;
+  DeviceFieldView dVelocityRTM_, dGpdx_, dCoordinates_, dPressure_, dDensity_, dEdgeAreaVec_;
 };
 
 } // namespace nalu
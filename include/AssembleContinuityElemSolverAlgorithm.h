@@ -43,6 +43,8 @@ public:
   VectorFieldType *coordinates_;
   ScalarFieldType *pressure_;
   ScalarFieldType *density_;
+  GenericFieldType *errorIndicator_;
+  GenericFieldType *mdotLinearization_;
 
   const bool shiftMdot_;
   const bool shiftPoisson_;
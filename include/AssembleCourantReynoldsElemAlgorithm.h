@@ -34,8 +34,9 @@ public:
   VectorFieldType *coordinates_;
   ScalarFieldType *density_;
   ScalarFieldType *viscosity_;
-  GenericFieldType *elemReynolds_;
-  GenericFieldType *elemCourant_;
+  // double, or float when held in single precision
+  stk::mesh::FieldBase *elemReynolds_;
+  stk::mesh::FieldBase *elemCourant_;
 };
 
 } // namespace nalu
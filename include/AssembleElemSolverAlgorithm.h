@@ -11,6 +11,7 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<SupplementalAlgorithmElemData.h>
 
 namespace stk {
 namespace mesh {
@@ -36,6 +37,9 @@ public:
   virtual void execute();
 
   const int sizeOfSystem_;
+
+  // coordinates and geometry shared by the supplemental algorithms
+  SuppAlgElemData suppAlgElemData_;
 };
 
 } // namespace nalu
@@ -24,6 +24,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleMomentumEdgeContactSolverAlgorithm : public SolverAlgorithm
 {
@@ -55,6 +56,7 @@ public:
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
 
   std::vector< const stk::mesh::FieldBase *> ghostFieldVec_;
 };
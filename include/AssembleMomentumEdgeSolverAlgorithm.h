@@ -17,6 +17,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleMomentumEdgeSolverAlgorithm : public SolverAlgorithm
 {
@@ -49,6 +50,7 @@ public:
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
 };
 
 } // namespace nalu
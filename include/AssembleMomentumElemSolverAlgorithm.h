@@ -11,10 +11,18 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<ElemColoring.h>
+#include<ElemBucketGather.h>
+#include<SupplementalAlgorithmElemData.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <vector>
 
 namespace stk {
 namespace mesh {
 class Part;
+class Bucket;
 }
 }
 
@@ -22,7 +30,9 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class MasterElement;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleMomentumElemSolverAlgorithm : public SolverAlgorithm
 {
@@ -36,13 +46,100 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // element work arrays; one per thread when assembly is threaded
+  struct ElemScratch {
+    std::vector<double> lhs_;
+    std::vector<double> rhs_;
+    std::vector<int> scratchIds_;
+    std::vector<double> scratchVals_;
+    std::vector<stk::mesh::Entity> connected_nodes_;
+    std::vector<double> ws_velocityNp1_;
+    std::vector<double> ws_vrtm_;
+    std::vector<double> ws_coordinates_;
+    std::vector<double> ws_dudx_;
+    std::vector<double> ws_densityNp1_;
+    std::vector<double> ws_viscosity_;
+    std::vector<double> ws_scs_areav_;
+    std::vector<double> ws_dndx_;
+    std::vector<double> ws_deriv_;
+    std::vector<double> ws_det_j_;
+    std::vector<double> ws_shape_function_;
+    // shifted ips at the edge midpoints; ip values are the mean of the left
+    // and right nodes and the central advection couples only those two
+    bool lumpedIp_;
+    // Hex8 geometry goes through the static kernels; ws_deriv_ is then
+    // evaluated once per topology
+    bool isHex8_;
+    // packed Hex8 geometry (lane fastest); packLane_ < 0 when not in use
+    std::vector<double> packCoords_;
+    std::vector<double> packAreav_;
+    std::vector<double> packDndx_;
+    std::vector<double> packDetJ_;
+    std::vector<double> packError_;
+    int packLane_;
+    // nodal fields of the current bucket; serial bucket loop only
+    ElemBucketGather bucketGather_;
+    bool bucketGathered_;
+    // Courant/Reynolds maxima of the elements assembled with this scratch
+    double maxCourant_;
+    double maxReynolds_;
+  };
+
+  // slots of the nodal fields in ElemScratch::bucketGather_
+  enum {
+    gatherVelocity_ = 0,
+    gatherVrtm_,
+    gatherCoordinates_,
+    gatherDudx_,
+    gatherDensity_,
+    gatherViscosity_
+  };
+
+  // number of Hex8 elements per geometry pack; fills AVX-512 lanes
+  enum { hex8PackSize_ = 8 };
+
+  void resize_scratch(
+    ElemScratch &scratch,
+    MasterElement *meSCS);
+
+  void compute_hex8_pack(
+    ElemScratch &scratch,
+    stk::mesh::Bucket &b,
+    const unsigned kBegin,
+    const unsigned numInPack);
+
+  void assemble_elem(
+    ElemScratch &scratch,
+    stk::mesh::Bucket &b,
+    const unsigned k,
+    MasterElement *meSCS,
+    MasterElement *meSCV);
+
+  // the element kernel for a fixed spatial dimension; ip vectors live on
+  // the stack and the dimension loops have constant trip counts
+  template <int nDim>
+  void assemble_elem_dim(
+    ElemScratch &scratch,
+    stk::mesh::Bucket &b,
+    const unsigned k,
+    MasterElement *meSCS,
+    MasterElement *meSCV);
+
   double van_leer(
     const double &dqm,
     const double &dqp,
     const double &small);
 
+  double limiter_error_indicator(
+    const double *p_velocityNp1,
+    const double *p_coordinates,
+    const double *p_dudx,
+    const int *lrscv,
+    const int numScsIp);
+
   const double includeDivU_;
   const double meshMotion_;
+  const bool shiftedIp_;
 
   VectorFieldType *velocityRTM_;
   VectorFieldType *velocity_;
@@ -51,9 +148,38 @@ public:
   ScalarFieldType *density_;
   ScalarFieldType *viscosity_;
   GenericFieldType *massFlowRate_;
+  GenericFieldType *scsAreav_;
+  GenericFieldType *scsDndx_;
+  GenericFieldType *errorIndicator_;
+  stk::mesh::FieldBase *elemReynolds_;
+  stk::mesh::FieldBase *elemCourant_;
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
+
+  // assemble_elem_dim of the realm's spatial dimension; set at construction
+  void (AssembleMomentumElemSolverAlgorithm::*assembleElemDim_)(
+    ElemScratch &, stk::mesh::Bucket &, const unsigned, MasterElement *, MasterElement *);
+
+  // advection options; extracted once per execute
+  int nDim_;
+  double alpha_;
+  double alphaUpw_;
+  double hoUpwind_;
+  bool useLimiter_;
+  bool computeErrorIndicator_;
+  bool computeCourantReynolds_;
+  double dt_;
+
+  // coloring for threaded assembly
+  ElemColoring elemColoring_;
+
+  // per-thread work arrays; persist across calls to avoid reallocation
+  std::vector<ElemScratch> threadScratch_;
+
+  // coordinates and geometry shared by the supplemental algorithms
+  SuppAlgElemData suppAlgElemData_;
 };
 
 } // namespace nalu
@@ -10,6 +10,7 @@
 #define AssembleNodalGradAlgorithmDriver_h
 
 #include <AlgorithmDriver.h>
+#include <FieldTypeDef.h>
 #include <string>
 
 namespace sierra{
@@ -32,6 +33,10 @@ public:
 
   const std::string scalarQName_;
   const std::string dqdxName_;
+
+  // when set, pre_work copies the previous gradient here in the sweep that
+  // zeros it (every node of dqdx, ghosts included)
+  VectorFieldType *saveField_;
   
 };
   
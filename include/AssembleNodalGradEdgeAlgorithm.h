@@ -11,6 +11,13 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<NodeEdgeGraph.h>
+
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
 
 namespace sierra{
 namespace nalu{
@@ -29,11 +36,24 @@ public:
 
   virtual void execute();
 
+  // single edge; scatters to the nodal gradient of both nodes
+  void assemble_edge(
+    stk::mesh::Bucket &b,
+    const unsigned k);
+
+  // single node; gathers its adjacent edges, see NodeEdgeGraph
+  void gather_node(
+    const size_t i);
+
+  int nDim_;
   ScalarFieldType *scalarQ_;
   VectorFieldType *dqdx_;
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *dualNodalVolume_;
 
+  // owner-computes adjacency for the threaded path
+  NodeEdgeGraph nodeEdgeGraph_;
+
 };
 
 } // namespace nalu
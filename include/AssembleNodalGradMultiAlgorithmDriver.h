@@ -0,0 +1,44 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleNodalGradMultiAlgorithmDriver_h
+#define AssembleNodalGradMultiAlgorithmDriver_h
+
+#include <AlgorithmDriver.h>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// drives nodal grad algorithms that assemble numComponents gradients, laid
+// out as dqdx[comp*nDim+j], in a single sweep
+class AssembleNodalGradMultiAlgorithmDriver : public AlgorithmDriver
+{
+public:
+
+  AssembleNodalGradMultiAlgorithmDriver(
+    Realm &realm,
+    const std::string & dqdxName,
+    const int numComponents);
+  ~AssembleNodalGradMultiAlgorithmDriver();
+
+  void pre_work();
+  void post_work();
+
+  const std::string dqdxName_;
+  const int numComponents_;
+  
+};
+  
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
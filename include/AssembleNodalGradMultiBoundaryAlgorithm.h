@@ -0,0 +1,45 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleNodalGradMultiBoundaryAlgorithm_h
+#define AssembleNodalGradMultiBoundaryAlgorithm_h
+
+#include<Algorithm.h>
+#include<FieldTypeDef.h>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// boundary contribution to AssembleNodalGradMultiEdgeAlgorithm
+class AssembleNodalGradMultiBoundaryAlgorithm : public Algorithm
+{
+public:
+  AssembleNodalGradMultiBoundaryAlgorithm(
+    Realm &realm,
+    stk::mesh::Part *part,
+    GenericFieldType *scalarQ,
+    GenericFieldType *dqdx,
+    const int numComponents,
+    const bool useShifted);
+  virtual ~AssembleNodalGradMultiBoundaryAlgorithm() {}
+
+  virtual void execute();
+
+  GenericFieldType *scalarQ_;
+  GenericFieldType *dqdx_;
+  const int numComponents_;
+  const bool useShifted_;
+
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
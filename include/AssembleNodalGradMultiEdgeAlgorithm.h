@@ -0,0 +1,47 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleNodalGradMultiEdgeAlgorithm_h
+#define AssembleNodalGradMultiEdgeAlgorithm_h
+
+#include<Algorithm.h>
+#include<FieldTypeDef.h>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// edge-based projected nodal gradient of the first numComponents of scalarQ;
+// area vectors and dual volumes are loaded once per edge for all components
+class AssembleNodalGradMultiEdgeAlgorithm : public Algorithm
+{
+public:
+
+  AssembleNodalGradMultiEdgeAlgorithm(
+    Realm &realm,
+    stk::mesh::Part *part,
+    GenericFieldType *scalarQ,
+    GenericFieldType *dqdx,
+    const int numComponents);
+  virtual ~AssembleNodalGradMultiEdgeAlgorithm() {}
+
+  virtual void execute();
+
+  GenericFieldType *scalarQ_;
+  GenericFieldType *dqdx_;
+  const int numComponents_;
+  VectorFieldType *edgeAreaVec_;
+  ScalarFieldType *dualNodalVolume_;
+
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -12,6 +12,7 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<NodeEdgeGraph.h>
 
 namespace sierra{
 namespace nalu{
@@ -30,11 +31,18 @@ public:
 
   virtual void execute();
 
+  // single node; gathers its adjacent edges, see NodeEdgeGraph
+  void gather_node(
+    const size_t i);
+
+  int nDim_;
   VectorFieldType *velocity_;
   GenericFieldType *dudx_;
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *dualNodalVolume_;
-  
+
+  // owner-computes adjacency for the threaded path
+  NodeEdgeGraph nodeEdgeGraph_;
 };
 
 } // namespace nalu
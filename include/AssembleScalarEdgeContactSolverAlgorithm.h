@@ -24,6 +24,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleScalarEdgeContactSolverAlgorithm : public SolverAlgorithm
 {
@@ -58,6 +59,7 @@ public:
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
   
   std::vector< const stk::mesh::FieldBase *> ghostFieldVec_;
 };
@@ -41,7 +41,13 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // Hermite weights of every halo node; coordinates only change when the
+  // contact manager re-initialises
+  void compute_hermite_weights();
+
   HermitePolynomialInterpolation *hermite_;
+  std::vector<std::vector<double> > hermiteWeights_;
+  size_t hermiteInitializeCount_;
   ScalarFieldType *scalarQ_;
   VectorFieldType *dqdx_;
   ScalarFieldType *diffFluxCoeff_;
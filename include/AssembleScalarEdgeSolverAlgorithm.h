@@ -11,6 +11,7 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<DeviceEdgeAssembly.h>
 
 namespace stk {
 namespace mesh {
@@ -23,6 +24,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleScalarEdgeSolverAlgorithm : public SolverAlgorithm
 {
@@ -38,6 +40,9 @@ public:
   virtual ~AssembleScalarEdgeSolverAlgorithm();
   virtual void initialize_connectivity();
   virtual void execute();
+
+  // edge kernel in the Kokkos execution space; false falls back to execute
+  bool execute_device();
   
   double van_leer(
     const double &dqm,
@@ -57,6 +62,12 @@ public:
 
   // peclect function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
+
+  // device copies for use_device_edge_assembly
+  DeviceEdgeData deviceData_;
+  DeviceFieldView dScalarQ_, dDqdx_, dDiffFluxCoeff_, dVelocityRTM_, dCoordinates_, dDensity_;
+  DeviceFieldView dMassFlowRate_, dEdgeAreaVec_;
 };
 
 } // namespace nalu
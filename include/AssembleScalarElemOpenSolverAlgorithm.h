@@ -23,6 +23,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleScalarElemOpenSolverAlgorithm : public SolverAlgorithm
 {
@@ -53,6 +54,7 @@ public:
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
 };
 
 } // namespace nalu
@@ -23,6 +23,7 @@ namespace nalu{
 
 class Realm;
 class PecletFunction;
+struct DofNumerics;
 
 class AssembleScalarElemSolverAlgorithm : public SolverAlgorithm
 {
@@ -39,12 +40,18 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // execute for a fixed spatial dimension; ip vectors live on the stack and
+  // the dimension loops have constant trip counts
+  template <int nDim>
+  void execute_dim();
+
   double van_leer(
     const double &dqm,
     const double &dqp,
     const double &small);
 
   const bool meshMotion_;
+  const bool shiftedIp_;
   
   ScalarFieldType *scalarQ_;
   VectorFieldType *dqdx_;
@@ -53,9 +60,12 @@ public:
   VectorFieldType *coordinates_;
   ScalarFieldType *density_;
   GenericFieldType *massFlowRate_;
+  GenericFieldType *scsAreav_;
+  GenericFieldType *scsDndx_;
 
   // peclet function specifics
   PecletFunction * pecletFunction_;
+  const DofNumerics *dofNumerics_;
 };
 
 } // namespace nalu
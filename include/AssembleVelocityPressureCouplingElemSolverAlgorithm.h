@@ -0,0 +1,55 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleVelocityPressureCouplingElemSolverAlgorithm_h
+#define AssembleVelocityPressureCouplingElemSolverAlgorithm_h
+
+#include<SolverAlgorithm.h>
+#include<FieldTypeDef.h>
+
+namespace stk {
+namespace mesh {
+class Part;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// off-diagonal blocks of the coupled (u,p) system: d(dpdx*dualVolume)/dp in
+// the momentum rows and d(mdot)/du in the continuity rows; interior scs only.
+// The open bc mdot is AssembleVelocityPressureCouplingOpenSolverAlgorithm; the
+// boundary closure of the nodal pressure gradient is not linearized
+class AssembleVelocityPressureCouplingElemSolverAlgorithm : public SolverAlgorithm
+{
+public:
+
+  AssembleVelocityPressureCouplingElemSolverAlgorithm(
+    Realm &realm,
+    stk::mesh::Part *part,
+    EquationSystem *eqSystem,
+    const bool shiftGradient,
+    const bool shiftMdot);
+  virtual ~AssembleVelocityPressureCouplingElemSolverAlgorithm() {}
+  virtual void initialize_connectivity();
+  virtual void execute();
+
+  // extract fields; nodal
+  VectorFieldType *coordinates_;
+  ScalarFieldType *density_;
+
+  const bool shiftGradient_;
+  const bool shiftMdot_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
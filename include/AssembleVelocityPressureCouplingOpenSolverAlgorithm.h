@@ -0,0 +1,54 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssembleVelocityPressureCouplingOpenSolverAlgorithm_h
+#define AssembleVelocityPressureCouplingOpenSolverAlgorithm_h
+
+#include<SolverAlgorithm.h>
+#include<FieldTypeDef.h>
+
+namespace stk {
+namespace mesh {
+class Part;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// d(mdot)/du of the open boundary mdot in the continuity rows of the coupled
+// (u,p) system; the bc pressure of the boundary nodal gradient is given, so
+// the momentum rows carry no pressure term here
+class AssembleVelocityPressureCouplingOpenSolverAlgorithm : public SolverAlgorithm
+{
+public:
+
+  AssembleVelocityPressureCouplingOpenSolverAlgorithm(
+    Realm &realm,
+    stk::mesh::Part *part,
+    EquationSystem *eqSystem,
+    const bool nearestNodeMdot);
+  virtual ~AssembleVelocityPressureCouplingOpenSolverAlgorithm() {}
+  virtual void initialize_connectivity();
+  virtual void execute();
+
+  // extract fields
+  ScalarFieldType *density_;
+  GenericFieldType *exposedAreaVec_;
+
+  // edge-based continuity takes mdot from the nearest node of each bip
+  const bool nearestNodeMdot_;
+  const bool shiftMdot_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
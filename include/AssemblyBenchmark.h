@@ -0,0 +1,50 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AssemblyBenchmark_h
+#define AssemblyBenchmark_h
+
+#include <string>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra{
+namespace nalu{
+
+class Simulation;
+
+// repeated assembly of the solver algorithms of one equation system on the
+// initialized realm; each algorithm's execute (including its sumInto) is
+// timed separately, the linear system is zeroed between repetitions and
+// never solved. Meant for generated meshes (mesh_type: generated)
+class AssemblyBenchmark {
+public:
+  AssemblyBenchmark(
+    Simulation &sim);
+  ~AssemblyBenchmark();
+
+  void load(const YAML::Node & node);
+  void run();
+
+  Simulation *root() { return &sim_; }
+  Simulation *parent() { return &sim_; }
+
+  Simulation &sim_;
+  std::string realmName_;
+  std::string equationSystemName_;
+  std::string algorithmName_; // empty for all solver algorithms
+  int repetitions_;
+  bool benchmarkOnly_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -20,6 +20,10 @@ public:
       endPos_(endPos) {}
   virtual ~AuxFunction() {}
 
+  // false when the values depend on the coordinates only; boundary data of
+  // such functions is evaluated once per mesh
+  virtual bool is_time_dependent() const { return true; }
+
   // coords:
   //    coordinates at each point, (x,y) for 2d, (x,y,z) for 3d
   // time:
@@ -42,10 +42,24 @@ public:
   virtual ~AuxFunctionAlgorithm();
   virtual void execute();
 
+  // coordinates are not written by any property algorithm
+  virtual bool field_dependencies(
+    std::vector<stk::mesh::FieldBase *> &reads,
+    std::vector<stk::mesh::FieldBase *> &writes) const {
+    writes.push_back(field_); return true; }
+
+  // boundary data; skipped while a time-independent function's values are
+  // still current (same mesh, no mesh motion)
+  void execute_boundary_data();
+
 private:
   stk::mesh::FieldBase * field_;
   AuxFunction *auxFunction_;
   stk::mesh::EntityRank entityRank_;
+
+  // mesh modification count of the last boundary data evaluation
+  size_t evaluatedSyncCount_;
+  bool isEvaluated_;
   
 private:
   // make this non-copyable
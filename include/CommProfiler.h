@@ -0,0 +1,79 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef CommProfiler_h
+#define CommProfiler_h
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Ghosting;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// calls and bytes sent per exchange site and neighbour rank; the bytes of
+// a field exchange are counted from the comm list of the ghosting, those of
+// other exchanges are supplied by the caller. Sites are recorded by
+// collective calls, so every rank holds the same set
+class CommProfiler
+{
+public:
+
+  CommProfiler(
+    Realm &realm);
+  ~CommProfiler();
+
+  // field data on a ghosting; the owner sends to each ghost (and sharer),
+  // for sums (parallel_sum) every sharer sends to every other sharer
+  void record_field_exchange(
+    const std::string &site,
+    const stk::mesh::Ghosting &ghosting,
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec,
+    const bool allSharersSend = false);
+
+  void record_field_exchange(
+    const std::string &site,
+    const stk::mesh::Ghosting &ghosting,
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const bool allSharersSend = false);
+
+  // one call of a site with the given bytes per neighbour
+  void record(
+    const std::string &site,
+    const std::vector<int> &procs,
+    const std::vector<size_t> &bytes);
+
+  // sites by total bytes over all ranks, largest first
+  void dump_summary(
+    const size_t maxSites = 10);
+
+private:
+
+  struct SiteStats {
+    SiteStats() : calls_(0) {}
+    size_t calls_;
+    std::map<int, size_t> bytes_; // by neighbour rank
+  };
+
+  Realm &realm_;
+  std::map<std::string, SiteStats> sites_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -12,7 +12,11 @@
 #include<Algorithm.h>
 
 // stk
+#include <stk_mesh/base/Entity.hpp>
 #include <stk_mesh/base/Part.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <vector>
 
 namespace sierra{
 namespace nalu{
@@ -31,7 +35,24 @@ public:
   void execute();
 
   const bool assembleEdgeAreaVec_;
-  
+  const bool cacheElemGeometry_;
+
+private:
+
+  // rebuild the element-edge table if the mesh has been modified
+  void update_edge_table(
+    const stk::mesh::BucketVector &element_buckets);
+
+  // number of Hex8 elements per geometry pack; fills AVX-512 lanes
+  enum { hex8PackSize_ = 8 };
+
+  // edge of each scs of each element, in bucket order, and the sign that
+  // orients the scs area vector from the left node of the edge
+  std::vector<stk::mesh::Entity> scsEdges_;
+  std::vector<double> scsEdgeSigns_;
+  size_t edgeTableSyncCount_;
+  size_t edgeTableNumBuckets_;
+  bool edgeTableBuilt_;
 };
 
 } // namespace nalu
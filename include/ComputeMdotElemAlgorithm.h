@@ -33,6 +33,9 @@ public:
   void execute();
   void assemble_edge_mdot();
 
+  // mdot = mdot(assembly) + d(mdot)/dp*pTmp; no geometry or velocity gather
+  void execute_linearized();
+
   const bool meshMotion_;
   const bool assembleMdotToEdge_;
 
@@ -44,6 +47,11 @@ public:
   ScalarFieldType *density_;
   GenericFieldType *massFlowRate_;
   ScalarFieldType *edgeMassFlowRate_;
+  ScalarFieldType *pTmp_;
+  GenericFieldType *mdotLinearization_;
+
+  // set by the continuity system directly after its solve and pressure update
+  bool useLinearization_;
 
   const bool shiftMdot_;
   const bool shiftPoisson_;
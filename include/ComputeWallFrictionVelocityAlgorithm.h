@@ -15,6 +15,8 @@
 // stk
 #include <stk_mesh/base/Part.hpp>
 
+#include <vector>
+
 namespace sierra{
 namespace nalu{
 
@@ -38,6 +40,13 @@ public:
       const double &up, const double &yp,
       const double &density, const double &viscosity,
       double &utau);
+
+  // compute_utau for n points at once; utau holds the guess on input
+  void compute_utau_batch(
+      const size_t n,
+      const double *up, const double *yp,
+      const double *density, const double *viscosity,
+      double *utau);
   
   void normalize_nodal_fields();
 
@@ -58,6 +67,10 @@ public:
   GenericFieldType *wallNormalDistanceBip_;
   ScalarFieldType *assembledWallNormalDistance_;
   ScalarFieldType *assembledWallArea_;
+
+  // scratch for compute_utau_batch
+  std::vector<size_t> activeBip_;
+  std::vector<double> wallLawA_;
 };
 
 } // namespace nalu
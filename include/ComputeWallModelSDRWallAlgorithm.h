@@ -36,9 +36,9 @@ public:
   const double sqrtBetaStar_;
   const double kappa_;
 
-  VectorFieldType *coordinates_;
   GenericFieldType *exposedAreaVec_;
   GenericFieldType *wallFrictionVelocityBip_;
+  GenericFieldType *wallNormalDistanceBip_;
   ScalarFieldType *sdrBc_;
   ScalarFieldType *assembledWallArea_;
 };
@@ -13,6 +13,7 @@
 // Includes and forwards
 //==============================================================================
 
+#include <HaloInfo.h>
 #include <master_element/MasterElement.h>
 
 // stk
@@ -24,7 +25,6 @@
 #include <stk_search/SearchMethod.hpp>
 
 #include <vector>
-#include <map>
 
 namespace stk {
 namespace mesh {
@@ -36,7 +36,6 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class HaloInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -76,7 +75,9 @@ class ContactInfo {
 
   ~ContactInfo();
 
-  void initialize();
+  void initialize(const bool meshUnchanged);
+  void find_halo_nodes();
+  void find_search_elements();
   void construct_halo_state();
   void populate_halo_mesh_velocity();
   void find_possible_elements();
@@ -119,8 +120,12 @@ class ContactInfo {
   std::vector<boundingPoint>      boundingPointVec_;
   std::vector<boundingElementBox> boundingElementBoxVec_;
 
-  /* map of HaloInfo */
-  std::map<uint64_t, HaloInfo *> haloInfoMap_;
+  /* halo data of the locally owned contact surface nodes, in node id order */
+  std::vector<HaloInfo> haloInfoVec_;
+  std::vector<uint64_t> haloNodeIds_;
+
+  /* locally owned elements of the search blocks */
+  std::vector<stk::mesh::Entity> searchElements_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
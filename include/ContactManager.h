@@ -60,6 +60,14 @@ class ContactManager {
   uint64_t needToGhostCount_;
   bool provideDetailedOutput_;
 
+  /* bulk data sync count after the last initialize; a match means only the
+     contact ghosting changed since, so the owned search entities are kept */
+  size_t syncCount_;
+
+  /* number of initialize calls; halo data cached by algorithms is current
+     while this is unchanged */
+  size_t initializeCount_;
+
   stk::mesh::EntityProcVec elemsToGhost_;
   std::vector<ContactInfo *> contactInfoVec_;
 
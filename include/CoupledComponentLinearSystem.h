@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef CoupledComponentLinearSystem_h
+#define CoupledComponentLinearSystem_h
+
+#include <LinearSystem.h>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// numDof components of a coupled system from dofOffset on, e.g., the
+// velocity (offset 0) and pressure (offset nDim) of the coupled low-Mach
+// system. Graphs, sums, Dirichlet rows and constraints go to the coupled
+// system; zeroing, load complete and solve are those of its owner
+class CoupledComponentLinearSystem : public LinearSystem
+{
+public:
+
+  CoupledComponentLinearSystem(
+    Realm &realm,
+    const unsigned numDof,
+    const std::string & name,
+    LinearSystem *coupledSystem,
+    const unsigned dofOffset);
+  virtual ~CoupledComponentLinearSystem() {}
+
+  // Graph/Matrix Construction
+  void buildNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildReducedElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeHaloNodeGraph(const stk::mesh::PartVector & parts);
+  void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts);
+  void buildOversetNodeGraph(const stk::mesh::PartVector & parts);
+  void finalizeLinearSystem() {}
+  bool updateInterfaceGraph() { return true; }
+
+  // Matrix Assembly
+  void zeroSystem() {}
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void prepareConstraints(
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete() {}
+
+  void writeToFile(const char * filename, bool useOwned=true);
+  void writeSolutionToFile(const char * filename, bool useOwned=true);
+
+  // residuals and iterations of the last coupled solve
+  void copySolveStatistics();
+
+  LinearSystem *coupledSystem_;
+  const unsigned dofOffset_;
+
+protected:
+  void beginLinearSystemConstruction() {}
+  void checkError(
+    const int err_code,
+    const char * msg) {}
+
+private:
+  // thread-private coupled element system and scratch
+  std::vector<std::vector<double> > coupledRhs_;
+  std::vector<std::vector<double> > coupledLhs_;
+  std::vector<std::vector<int> > coupledIds_;
+  std::vector<std::vector<double> > coupledVals_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
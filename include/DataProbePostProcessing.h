@@ -12,6 +12,7 @@
 #include <NaluParsing.h>
 
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -23,6 +24,7 @@ namespace stk {
   namespace mesh {
     class BulkData;
     class FieldBase;
+    class Ghosting;
     class MetaData;
     class Part;
     //class Selector; ? why is this?
@@ -34,11 +36,12 @@ namespace stk {
 namespace sierra{
 namespace nalu{
 
+class MasterElement;
 class Realm;
 
 class DataProbeInfo {
 public:
-  DataProbeInfo() { }
+  DataProbeInfo() : isLineOfSite_(false), numProbes_(0) { }
   ~DataProbeInfo() {}
 
   // for each type of probe, e.g., line of site, hold some stuff
@@ -49,18 +52,46 @@ public:
   std::vector<int> numPoints_;
   std::vector<Coordinates> tipCoordinates_;
   std::vector<Coordinates> tailCoordinates_;
+
+  // planes; corner plus numPlanePoints_ along each of the two edges
+  std::vector<Coordinates> cornerCoordinates_;
+  std::vector<Coordinates> edgeOneVector_;
+  std::vector<Coordinates> edgeTwoVector_;
+  std::vector<std::pair<int, int> > numPlanePoints_;
   std::vector<std::pair<std::string, int> > fieldInfo_;
   std::vector<std::vector<stk::mesh::Entity> > nodeVector_;
   std::vector<stk::mesh::Part *> part_;
+
+  // samples of each probe not yet appended to its file (owning rank only);
+  // per sample: time, then the fields point by point
+  std::vector<std::vector<double> > sampleBuffer_;
+  std::vector<int> numBufferedSamples_;
+  std::vector<bool> fileCreated_;
+
+  // interpolated sampling: source field of each entry in fieldInfo_ and,
+  // per probe point, its coordinates (owning rank), donor element, master
+  // element and isoparametric coordinates; located once (static mesh) and
+  // reused for every sample
+  std::vector<std::string> fromFieldName_;
+  std::vector<std::vector<double> > pointCoordinates_;
+  std::vector<std::vector<stk::mesh::Entity> > donorElement_;
+  std::vector<std::vector<MasterElement *> > donorMasterElement_;
+  std::vector<std::vector<double> > donorIsoParCoords_;
+
+  // planes have no mesh part; samples land here, point by point
+  std::vector<std::vector<double> > planeValues_;
 };
 
 class DataProbeSpecInfo {
 public:
-  DataProbeSpecInfo() { }
+  DataProbeSpecInfo() : interpolate_(false) { }
   ~DataProbeSpecInfo() {}
 
   std::string xferName_;
   std::vector<std::string> fromTargetNames_;
+
+  // sample through cached donor elements rather than the xfer transfer
+  bool interpolate_;
   
   // vector of averaging information
   std::vector<DataProbeInfo *> dataProbeInfo_;
@@ -97,11 +128,31 @@ public:
   // we want these nodes to be excluded from anything of importance
   void create_inactive_selector();
 
+  // locate the donor element of every interpolated probe point
+  void initialize_interpolation();
+
   // populate nodal field and output norms (if appropriate)
   void execute();
 
+  // fill the probe fields of interpolated specifications from their donors
+  void interpolate_probes();
+
+  // hand the owned planes of this sample to the writer thread
+  void write_planes(const double currentTime);
+
+  // wait for the writer thread of the previous sample
+  void complete_plane_writes();
+
   // output the average value
   void provide_average(const double currentTime, const double timeStepCount);
+
+  // buffer a sample of every owned probe; appended once bufferSize_ are held
+  void sample_probes(const double currentTime);
+
+  // append the buffered samples of probe j to its binary time series file
+  void flush_probe(
+    DataProbeInfo *probeInfo,
+    const int j);
   
   // provide the inactive selector
   stk::mesh::Selector &get_inactive_selector();
@@ -111,6 +162,10 @@ public:
 
   // frequency of output
   int outputFreq_;
+
+  // binary per-probe time series in place of the text means
+  bool binaryOutput_;
+  int bufferSize_;
   
   // vector of specifications
   std::vector<DataProbeSpecInfo *> dataProbeSpecInfo_;
@@ -118,6 +173,13 @@ public:
   // hold all the parts; provide a selector
   stk::mesh::PartVector allTheParts_;
   stk::mesh::Selector inactiveSelector_;
+
+  // donor elements of interpolated probe points owned elsewhere
+  stk::mesh::Ghosting *probeGhosting_;
+
+  // plane records (file name and bytes) written while the solve resumes
+  std::vector<std::pair<std::string, std::vector<char> > > planeWriteVec_;
+  std::thread planeWriter_;
 };
 
 } // namespace nalu
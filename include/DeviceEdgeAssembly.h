@@ -0,0 +1,123 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef DeviceEdgeAssembly_h
+#define DeviceEdgeAssembly_h
+
+#include <DeviceTypes.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class LinearSystem;
+class Realm;
+
+typedef Kokkos::View<int*[2], DeviceType> DeviceEdgeView;
+
+// local matrices and rhs of a single-dof Tpetra system, copied by value
+// into a kernel; sums from concurrent edges are atomic
+struct DeviceEdgeSystem
+{
+  typedef LinSys::Matrix::local_matrix_type LocalMatrix;
+  typedef LinSys::Vector::dual_view_type::t_dev LocalVector;
+
+  LocalMatrix ownedMatrix_;
+  LocalMatrix globallyOwnedMatrix_;
+  LocalVector ownedRhs_;
+  LocalVector globallyOwnedRhs_;
+  int maxOwnedRowId_;
+  int maxGloballyOwnedRowId_;
+  bool assembleLhs_;
+
+  // lhs is the 2x2 edge matrix, row major; rows are the system row offsets
+  KOKKOS_INLINE_FUNCTION
+  void sum_into(
+    const int rowL,
+    const int rowR,
+    const double *lhs,
+    const double *rhs) const
+  {
+    // columns in ascending order
+    const bool leftFirst = rowL < rowR;
+    const int cols[2] = {leftFirst ? rowL : rowR, leftFirst ? rowR : rowL};
+    const int rows[2] = {rowL, rowR};
+    for ( int r = 0; r < 2; ++r ) {
+      const double vals[2] = {leftFirst ? lhs[2*r] : lhs[2*r+1], leftFirst ? lhs[2*r+1] : lhs[2*r]};
+      const int row = rows[r];
+      if ( row < maxOwnedRowId_ ) {
+        if ( assembleLhs_ )
+          ownedMatrix_.sumIntoValues(row, cols, 2, vals, true, true);
+        Kokkos::atomic_add(&ownedRhs_(row,0), rhs[r]);
+      }
+      else if ( row < maxGloballyOwnedRowId_ ) {
+        const int actualRow = row - maxOwnedRowId_;
+        if ( assembleLhs_ )
+          globallyOwnedMatrix_.sumIntoValues(actualRow, cols, 2, vals, true, true);
+        Kokkos::atomic_add(&globallyOwnedRhs_(actualRow,0), rhs[r]);
+      }
+    }
+  }
+};
+
+// device copy of the edge->node topology of an edge solver algorithm and
+// the row offsets of its nodes; rebuilt when the mesh changes. Node and
+// edge fields are copied into views each execute since stk owns them on
+// the host
+class DeviceEdgeData
+{
+public:
+
+  DeviceEdgeData();
+  ~DeviceEdgeData();
+
+  // false when the linear system can not be assembled on the device
+  bool update(
+    Realm &realm,
+    const stk::mesh::Selector &edgeSelector,
+    LinearSystem &linsys);
+
+  // (node, component) and (edge, component) copies
+  void copy_node_field(
+    const stk::mesh::FieldBase &field,
+    const int numComp,
+    DeviceFieldView &view) const;
+  void copy_edge_field(
+    const stk::mesh::FieldBase &field,
+    const int numComp,
+    DeviceFieldView &view) const;
+
+  int num_edges() const { return edges_.size(); }
+
+  // node index into the node views and row offset into the system
+  DeviceEdgeView edgeNodes_;
+  DeviceEdgeView edgeRows_;
+
+private:
+
+  std::vector<stk::mesh::Entity> edges_;
+  std::vector<stk::mesh::Entity> nodes_;
+  size_t syncCount_;
+  bool valid_;
+  bool built_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
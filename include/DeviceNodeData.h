@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef DeviceNodeData_h
+#define DeviceNodeData_h
+
+#include <DeviceTypes.h>
+
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// node buckets of a nodal algorithm laid end to end in device views; the
+// bucket list is rebuilt when the mesh changes, field values are copied
+// per execute since stk owns them on the host
+class DeviceNodeData
+{
+public:
+
+  DeviceNodeData();
+  ~DeviceNodeData();
+
+  void update(
+    Realm &realm,
+    const stk::mesh::Selector &selector);
+
+  int num_nodes() const { return numNodes_; }
+
+  // single component field to and from a node view
+  void copy_to_device(
+    const stk::mesh::FieldBase &field,
+    DeviceNodeView &view) const;
+  void copy_to_host(
+    const DeviceNodeView &view,
+    const stk::mesh::FieldBase &field) const;
+
+  // single component field into column of a (node, column) view sized
+  // numColumns; the view is reallocated when the sizes change
+  void copy_to_device(
+    const stk::mesh::FieldBase &field,
+    const int column,
+    const int numColumns,
+    DeviceFieldView &view) const;
+
+private:
+
+  stk::mesh::BucketVector buckets_;
+  int numNodes_;
+  size_t syncCount_;
+  bool built_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,30 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef DeviceTypes_h
+#define DeviceTypes_h
+
+#include <LinearSolverTypes.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace sierra{
+namespace nalu{
+
+// execution space of the Tpetra node; the local matrices live there
+typedef LinSys::Node::device_type                               DeviceType;
+typedef DeviceType::execution_space                             DeviceExecSpace;
+
+// (entity, component) and single component copies of stk fields
+typedef Kokkos::View<double**, Kokkos::LayoutLeft, DeviceType>  DeviceFieldView;
+typedef Kokkos::View<double*, DeviceType>                       DeviceNodeView;
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
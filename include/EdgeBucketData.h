@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EdgeBucketData_h
+#define EdgeBucketData_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class Bucket;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// edge table for one bucket in structure-of-arrays form; component j of
+// edge k lives at j*length_+k so the kernels over a bucket are unit stride
+// and free of field_data lookups
+class EdgeBucketData
+{
+public:
+
+  EdgeBucketData();
+  ~EdgeBucketData();
+
+  // node handles, area vector, dx and the axdx/asq metrics of the bucket
+  void gather(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::Bucket &bucket,
+    const VectorFieldType &coordinates,
+    const VectorFieldType &edgeAreaVec,
+    const int nDim);
+
+  // sum_j a_j*b_j over the bucket, both in SoA form
+  void dot(
+    const double *a,
+    const double *b,
+    double *result) const;
+
+  // pointer to component j of a SoA array
+  const double *component(const std::vector<double> &soa, const int j) const {
+    return &soa[j*length_]; }
+
+  int nDim_;
+  size_t length_;
+
+  std::vector<stk::mesh::Entity> nodeL_;
+  std::vector<stk::mesh::Entity> nodeR_;
+
+  std::vector<double> areaVec_;
+  std::vector<double> dx_;
+  std::vector<double> axdx_;
+  std::vector<double> asq_;
+  std::vector<double> invAxdx_;
+};
+
+// MUSCL extrapolation to the edge midpoint over n entries, unit stride;
+// dqL and dqR are the half edge projections of the nodal gradients. The
+// van Leer limiter is a template argument, picked once per execute, so the
+// loop body carries no branch and vectorises
+template <bool limited>
+inline void muscl_extrapolate(
+  const size_t n,
+  const double hoUpwind,
+  const double *qL,
+  const double *qR,
+  const double *dqL,
+  const double *dqR,
+  double *qIpL,
+  double *qIpR)
+{
+  const double small = 1.0e-16;
+  for ( size_t k = 0; k < n; ++k ) {
+    double limitL = 1.0;
+    double limitR = 1.0;
+    if ( limited ) {
+      const double dq = qR[k] - qL[k];
+      const double dqMl = 2.0*2.0*dqL[k] - dq;
+      const double dqMr = 2.0*2.0*dqR[k] - dq;
+      limitL = (2.0*(dqMl*dq + std::fabs(dqMl*dq)))/((dqMl+dq)*(dqMl+dq) + small);
+      limitR = (2.0*(dqMr*dq + std::fabs(dqMr*dq)))/((dqMr+dq)*(dqMr+dq) + small);
+    }
+    qIpL[k] = qL[k] + dqL[k]*hoUpwind*limitL;
+    qIpR[k] = qR[k] - dqR[k]*hoUpwind*limitR;
+  }
+}
+
+typedef void (*MusclExtrapolateFunction)(
+  const size_t, const double, const double *, const double *,
+  const double *, const double *, double *, double *);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
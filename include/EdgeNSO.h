@@ -0,0 +1,32 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EdgeNSO_h
+#define EdgeNSO_h
+
+namespace sierra{
+namespace nalu{
+
+// NSO artificial diffusivity, nu*g^ij, for one scalar (or velocity component) on an edge.
+// The element metric is replaced by the edge metric, g^ij = h^2 delta_ij and
+// g_ij = delta_ij/h^2 with h the edge length. The residual is the jump between
+// the edge difference and the projected nodal gradient, rho*u.(dq/dx|edge - Gjq)
+double edge_nso_diffusivity(
+  const int nDim,
+  const double rhoIp,
+  const double *vrtmIp,
+  const double *dx,
+  const double dq,
+  const double *GjqIp,
+  const double Cupw,
+  const double small);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
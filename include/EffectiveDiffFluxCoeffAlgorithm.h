@@ -13,6 +13,12 @@
 
 #include<FieldTypeDef.h>
 
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
@@ -33,6 +39,9 @@ public:
   virtual ~EffectiveDiffFluxCoeffAlgorithm() {}
   virtual void execute();
 
+  // evisc for the nodes of a single bucket; visc and tvisc must be current
+  void execute_bucket(stk::mesh::Bucket &b);
+
   ScalarFieldType *visc_;
   ScalarFieldType *tvisc_;
   ScalarFieldType *evisc_;
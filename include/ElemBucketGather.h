@@ -0,0 +1,82 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ElemBucketGather_h
+#define ElemBucketGather_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class Bucket;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// nodal fields of one element bucket staged into contiguous arrays, one
+// array per field; element k holds a [node][component] block at
+// k*nodesPerElement*numComp, the same layout as the ws_ gather arrays of
+// the element algorithms. The (bucket, ordinal) of every element node is
+// resolved once per gather and shared by all fields
+class ElemBucketGather
+{
+public:
+
+  ElemBucketGather();
+  ~ElemBucketGather();
+
+  // register a nodal field; returns its slot
+  int add_field(
+    const stk::mesh::FieldBase *field,
+    const int numComp);
+
+  // swap the field of a slot, e.g., for a change of state
+  void set_field(
+    const int slot,
+    const stk::mesh::FieldBase *field);
+
+  int num_fields() const { return fields_.size(); }
+
+  // stage all registered fields of the bucket
+  void gather(
+    const stk::mesh::BulkData &bulkData,
+    const stk::mesh::Bucket &bucket);
+
+  // [node][component] block of element k
+  const double *element_values(const int slot, const size_t k) const {
+    return &values_[slot][k*nodesPerElement_*numComp_[slot]]; }
+
+  // bucket of the last gather; NULL before the first one
+  const stk::mesh::Bucket *bucket() const { return bucket_; }
+
+  size_t length_;
+  int nodesPerElement_;
+
+private:
+
+  const stk::mesh::Bucket *bucket_;
+
+  std::vector<const stk::mesh::FieldBase *> fields_;
+  std::vector<int> numComp_;
+  std::vector<std::vector<double> > values_;
+
+  // node location in its own bucket, element major
+  std::vector<const stk::mesh::Bucket *> nodeBucket_;
+  std::vector<unsigned> nodeOrdinal_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
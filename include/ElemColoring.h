@@ -0,0 +1,140 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ElemColoring_h
+#define ElemColoring_h
+
+#include <stk_mesh/base/Types.hpp>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_topology/topology.hpp>
+
+#if defined (NALU_USES_OPENMP)
+#include <omp.h>
+#endif
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// thread helpers; collapse to a single thread when OpenMP is not active
+inline int nalu_max_threads() {
+#if defined (NALU_USES_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+inline int nalu_thread_id() {
+#if defined (NALU_USES_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+// single element (or edge) reference; bucket and ordinal within
+struct ElemColorEntry {
+  stk::mesh::Bucket *bucket_;
+  unsigned ordinal_;
+};
+
+// all entities of one topology, split into colors; no two entities within a
+// color share a node and can, therefore, be scattered concurrently
+struct ElemColorGroup {
+  stk::topology topo_;
+  std::vector<std::vector<ElemColorEntry> > colors_;
+};
+
+class ElemColoring
+{
+public:
+
+  // rank is ELEMENT_RANK or EDGE_RANK; any rank with node connectivity works
+  ElemColoring(
+    Realm &realm,
+    stk::mesh::EntityRank rank = stk::topology::ELEMENT_RANK);
+  ~ElemColoring();
+
+  // rebuild colors if the mesh has been modified since the last call
+  void update(
+    const stk::mesh::Selector &selector);
+
+  const std::vector<ElemColorGroup> &groups() const { return groups_; }
+
+  size_t number_of_colors() const;
+
+  // loop all colors of a group in sequence; elements of a color are
+  // processed by the available threads. The kernel must only use
+  // thread-private scratch, indexed with nalu_thread_id()
+  template <class Kernel>
+  static void execute(
+    const ElemColorGroup &group,
+    Kernel &kernel)
+  {
+    const size_t numColors = group.colors_.size();
+    for ( size_t c = 0; c < numColors; ++c ) {
+      const std::vector<ElemColorEntry> &theColor = group.colors_[c];
+      const int numEntries = theColor.size();
+#if defined (NALU_USES_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+      for ( int i = 0; i < numEntries; ++i ) {
+        const ElemColorEntry &entry = theColor[i];
+        kernel(*entry.bucket_, entry.ordinal_);
+      }
+    }
+  }
+
+  // as above, restricted to the buckets of selector; a coloring of a
+  // superset remains conflict-free for any subset
+  template <class Kernel>
+  static void execute(
+    const ElemColorGroup &group,
+    const stk::mesh::Selector &selector,
+    Kernel &kernel)
+  {
+    const size_t numColors = group.colors_.size();
+    for ( size_t c = 0; c < numColors; ++c ) {
+      const std::vector<ElemColorEntry> &theColor = group.colors_[c];
+      const int numEntries = theColor.size();
+#if defined (NALU_USES_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+      for ( int i = 0; i < numEntries; ++i ) {
+        const ElemColorEntry &entry = theColor[i];
+        if ( selector(*entry.bucket_) )
+          kernel(*entry.bucket_, entry.ordinal_);
+      }
+    }
+  }
+
+private:
+
+  size_t row_offset(
+    stk::mesh::Entity node) const;
+
+  void build(
+    const stk::mesh::Selector &selector);
+
+  Realm &realm_;
+  const stk::mesh::EntityRank rank_;
+  size_t syncCount_;
+  size_t numBuckets_;
+  bool isBuilt_;
+  std::vector<ElemColorGroup> groups_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -59,6 +59,7 @@ enum EquationType {
   EQ_PNG_H = 13,
   EQ_PNG_U = 14,
   EQ_PNG_TKE = 15, // FIXME... Last PNG managed like this..
+  EQ_LOW_MACH = 16,
   EquationSystemType_END
 };
 
@@ -78,7 +79,8 @@ static const std::string EquationTypeMap[] = {
   "PNG_Z",
   "PNG_H",
   "PNG_U",
-  "PNG_TKE"
+  "PNG_TKE",
+  "Low_Mach"
 };
 
 enum UserDataType {
@@ -211,6 +213,19 @@ const std::string NonConformalAlgTypeNames[] = {
   "rb",
   "END" };
 
+enum InitialGuessType {
+  INITIAL_GUESS_ZERO = 0,
+  INITIAL_GUESS_POLYNOMIAL = 1,
+  INITIAL_GUESS_POD = 2,
+  INITIAL_GUESS_END = 3
+};
+
+const std::string InitialGuessTypeNames[] = {
+  "zero",
+  "polynomial",
+  "pod",
+  "END" };
+
 } // namespace nalu
 } // namespace Sierra
 
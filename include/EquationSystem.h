@@ -11,6 +11,10 @@
 
 #include<NaluParsing.h>
 
+#include<iosfwd>
+#include<limits>
+#include<stdexcept>
+
 namespace stk{
 struct topology;
 namespace mesh{
@@ -75,8 +79,10 @@ public:
   virtual void provide_output() {}
   virtual void pre_timestep_work() {}
   virtual void reinitialize_linear_system() {}
+  virtual void update_interface_linear_system();
   virtual void post_adapt_work() {}
-  virtual void dump_eq_time();
+  // optionally appends the phase timers as json entries to summary
+  virtual void dump_eq_time(std::ostream *summary = NULL);
   virtual double provide_scaled_norm();
   virtual double provide_norm();
   virtual double provide_norm_increment();
@@ -143,8 +149,34 @@ public:
     get_required(node, "name", name_);
     get_required(node, "max_iterations", maxIterations_);
     get_required(node, "convergence_tolerance", convergenceTolerance_);
+    get_if_present(node, "lhs_reassembly_frequency", lhsReassemblyFrequency_, lhsReassemblyFrequency_);
+    get_if_present(node, "lhs_reassembly_per_time_step", lhsReassemblyPerTimeStep_, lhsReassemblyPerTimeStep_);
+    if ( lhsReassemblyFrequency_ < 1 )
+      throw std::runtime_error("lhs_reassembly_frequency must be greater than zero");
+    get_if_present(node, "skip_when_converged", skipWhenConverged_, skipWhenConverged_);
+    get_if_present(node, "converged_recheck_frequency", convergedRecheckFrequency_, convergedRecheckFrequency_);
+    load_initial_guess(node);
   }
 
+  // initial_guess and initial_guess_history; also used by systems that load
+  // their children from the parent block
+  void load_initial_guess(const YAML::Node & node);
+
+  // decide whether the current LHS is reused for this assemble_and_solve
+  bool reuse_lhs();
+
+  // state np1 of a dof from state n; extrapolated from n and nm1 when
+  // extrapolate_predictor is active, falling back to n outside the bounds
+  void predict_dof_state(
+    stk::mesh::FieldBase &dof,
+    const double lowerBound = -std::numeric_limits<double>::max(),
+    const double upperBound = std::numeric_limits<double>::max());
+
+  // decide whether this outer iteration skips assembly and solve; and
+  // record the convergence state the next decision is based on
+  bool skip_solve();
+  void record_convergence(const bool isConverged);
+
   Simulation *root();
   EquationSystems *parent();
 
@@ -154,6 +186,27 @@ public:
   int maxIterations_;
   double convergenceTolerance_;
 
+  // LHS is rebuilt every lhsReassemblyFrequency_ nonlinear iterations (or
+  // time steps); the RHS is always assembled
+  int lhsReassemblyFrequency_;
+  bool lhsReassemblyPerTimeStep_;
+  int lhsReuseCount_;
+  int lhsAssemblyStep_;
+  // set by systems that solve several dofs with one operator
+  bool forceLhsReuse_;
+
+  // systems converged in an earlier outer iteration of this time step are
+  // skipped; re-solved every convergedRecheckFrequency_ skips (0: never)
+  bool skipWhenConverged_;
+  int convergedRecheckFrequency_;
+  int convergedStep_;
+  int skippedIterations_;
+  bool skippedThisIteration_;
+
+  // linear solve initial guess from the last initialGuessHistory_ increments
+  InitialGuessType initialGuessType_;
+  int initialGuessHistory_;
+
   // driver that holds all solver algorithms
   SolverAlgorithmDriver *solverAlgDriver_;
 
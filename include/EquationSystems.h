@@ -23,6 +23,7 @@ class Part;
 }
 
 #include <map>
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -36,6 +37,7 @@ namespace YAML {
 namespace sierra{
 namespace nalu{
 
+class AndersonAcceleration;
 class Realm;
 class EquationSystem;
 class PostProcessingData;
@@ -117,6 +119,7 @@ class EquationSystems
 
   void initialize();
   void reinitialize_linear_system();
+  void update_interface_linear_system();
   void post_adapt_work();
   void populate_derived_quantities();
   void initial_work();
@@ -128,7 +131,7 @@ class EquationSystems
   void populate_boundary_data();
   void boundary_data_to_state_data();
   void provide_output();
-  void dump_eq_time();
+  void dump_eq_time(std::ostream *summary = NULL);
   void pre_timestep_work();
   void post_converged_work();
   void evaluate_properties();
@@ -139,6 +142,9 @@ class EquationSystems
 
   EquationSystemVector equationSystemVector_;
   std::map<std::string, std::string> solverSpecMap_;
+
+  // optional acceleration of the nonlinear iterations
+  AndersonAcceleration *andersonAcceleration_;
 };
 
 } // namespace nalu
@@ -46,6 +46,9 @@ public:
 #endif
 
   double maxErrorIndicator_;
+
+  // element assembly already populated the indicator; only the marker needs to run
+  bool fusedWithAssembly_;
 };
 
 } // namespace nalu
@@ -0,0 +1,66 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ExecutionPlan_h
+#define ExecutionPlan_h
+
+#include <stk_mesh/base/Types.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_topology/topology.hpp>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+class MasterElement;
+
+// the buckets of one topology and their master elements; per topology setup
+// (scratch sizes, elem_resize of the supplemental algorithms) happens once
+// per group rather than once per bucket
+struct ExecutionGroup {
+  stk::topology topo_;
+  MasterElement *meSCS_;
+  MasterElement *meSCV_; // element rank only
+  std::vector<stk::mesh::Bucket *> buckets_;
+};
+
+class ExecutionPlan
+{
+public:
+
+  ExecutionPlan(
+    Realm &realm,
+    stk::mesh::EntityRank rank = stk::topology::ELEMENT_RANK);
+  ~ExecutionPlan();
+
+  // rebuild the groups if the mesh has been modified since the last call;
+  // an algorithm passes the same selector on every call
+  void update(
+    const stk::mesh::Selector &selector);
+
+  const std::vector<ExecutionGroup> &groups() const { return groups_; }
+
+private:
+
+  void build(
+    const stk::mesh::Selector &selector);
+
+  Realm &realm_;
+  const stk::mesh::EntityRank rank_;
+  size_t syncCount_;
+  size_t numBuckets_;
+  bool isBuilt_;
+  std::vector<ExecutionGroup> groups_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
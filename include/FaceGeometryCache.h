@@ -0,0 +1,56 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef FaceGeometryCache_h
+#define FaceGeometryCache_h
+
+#include <map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// face_grad_op of the connected element at the boundary ips, computed once
+// per face bucket and shared by every boundary algorithm that visits the
+// face; dropped when the mesh changes. The parent element topology is only
+// known per bucket, hence no side rank field. Static meshes only
+class FaceGeometryCache
+{
+public:
+
+  FaceGeometryCache(Realm &realm);
+  ~FaceGeometryCache();
+
+  // dndx of face k, numScsBip*nodesPerElement*nDim
+  const double *face_dndx(
+    const stk::mesh::Bucket &faceBucket,
+    const size_t k);
+
+private:
+
+  void compute_bucket(
+    const stk::mesh::Bucket &faceBucket,
+    std::vector<double> &dndx);
+
+  Realm &realm_;
+  size_t syncCount_;
+  std::map<const stk::mesh::Bucket *, std::vector<double> > faceDndx_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -91,6 +91,19 @@ void field_index_copy(
   const bool auraIsActive,
   const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
 
+// z = (1+r)*x - r*y; z = x where the result leaves [lowerBound, upperBound]
+void field_extrapolate(
+  const stk::mesh::MetaData & metaData,
+  const stk::mesh::BulkData & bulkData,
+  const double r,
+  const stk::mesh::FieldBase & xField,
+  const stk::mesh::FieldBase & yField,
+  const stk::mesh::FieldBase & zField,
+  const double lowerBound,
+  const double upperBound,
+  const bool auraIsActive,
+  const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
+
 } // namespace nalu
 } // namespace Sierra
 
@@ -26,6 +26,10 @@ typedef stk::mesh::Field<double, stk::mesh::Cartesian>  VectorFieldType;
 // define generic
 typedef stk::mesh::Field<double, stk::mesh::SimpleArrayTag>  GenericFieldType;
 
+// single precision storage for diagnostics outside of the linear solve
+typedef stk::mesh::Field<float>  ScalarFloatFieldType;
+typedef stk::mesh::Field<float, stk::mesh::SimpleArrayTag>  GenericFloatFieldType;
+
 // field type for local ids
 typedef unsigned LocalId;
 typedef stk::mesh::Field<LocalId>  LocalIdFieldType;
@@ -0,0 +1,96 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef GhostedNodeFieldExchange_h
+#define GhostedNodeFieldExchange_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+class Ghosting;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// GhostedNodeFieldExchange
+//=============================================================================
+/**
+ * * @par Description:
+ * - owner to ghost copy of nodal fields over one ghosting; equivalent to
+ *   stk::mesh::communicate_field_data restricted to the ghosted nodes.
+ *
+ * @par Design Considerations:
+ * - the ghosted nodes of each neighbour are listed once (a send plan): the
+ *   owner sends the ids of its ghosted nodes, sorted, when the plan is
+ *   built, and both sides pack in that order afterwards. Elements, faces
+ *   and edges that came with the ghosting are never visited and all fields
+ *   of an exchange travel in one message per neighbour. The plan is rebuilt
+ *   when the bulk data has been modified since.
+ */
+//=============================================================================
+class GhostedNodeFieldExchange {
+
+ public:
+
+  GhostedNodeFieldExchange(
+    stk::mesh::BulkData &bulkData,
+    const stk::mesh::Ghosting &ghosting);
+  ~GhostedNodeFieldExchange();
+
+  // collective; node rank fields only
+  void exchange(const std::vector<const stk::mesh::FieldBase *> &fields);
+
+ private:
+
+  void build_plan();
+
+  // doubles of all fields on one node
+  size_t node_size(
+    const std::vector<const stk::mesh::FieldBase *> &fields,
+    stk::mesh::Entity node) const;
+
+  stk::mesh::BulkData &bulkData_;
+  const stk::mesh::Ghosting &ghosting_;
+  MPI_Comm comm_;
+  size_t syncCount_;
+  bool planBuilt_;
+
+  // neighbour procs and their ghosted nodes, flattened with offsets
+  std::vector<int> sendProcs_;
+  std::vector<size_t> sendOffset_;
+  std::vector<stk::mesh::Entity> sendNodes_;
+  std::vector<int> recvProcs_;
+  std::vector<size_t> recvOffset_;
+  std::vector<stk::mesh::Entity> recvNodes_;
+
+  std::vector<double> sendBuffer_;
+  std::vector<double> recvBuffer_;
+  std::vector<MPI_Request> requests_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
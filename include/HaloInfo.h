@@ -15,8 +15,6 @@
 
 #include <stk_mesh/base/Entity.hpp>
 
-#include <vector>
-
 namespace sierra {
 namespace nalu {
 
@@ -44,18 +42,17 @@ class HaloInfo {
 
   ~HaloInfo();
 
-  void resize_vectors(const int nDim);
-  
   stk::mesh::Entity faceNode_;
   stk::mesh::Entity owningElement_;
   stk::mesh::Entity prevOwningElement_;
-  
-  std::vector<double> haloEdgeAreaVec_;
-  std::vector<double> haloNodalCoords_;
-  std::vector<double> haloMeshVelocity_;
-  std::vector<double> checkhaloNodalCoords_;
-  std::vector<double> nodalCoords_;
-  std::vector<double> isoParCoords_;
+
+  // fixed size; HaloInfo is stored by value, one per contact node
+  double haloEdgeAreaVec_[3];
+  double haloNodalCoords_[3];
+  double haloMeshVelocity_[3];
+  double checkhaloNodalCoords_[3];
+  double nodalCoords_[3];
+  double isoParCoords_[3];
   double haloEdgeDs_;
   double bestX_;
   int elemIsGhosted_;
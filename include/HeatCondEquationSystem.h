@@ -77,6 +77,10 @@ public:
   void solve_and_update();
   void compute_projected_nodal_gradient();
 
+  // constant conductivity and rho*cp on a static mesh with linear bcs;
+  // the operator then changes only with the time step or the gammas
+  bool linear_operator();
+
   void initialize();
   void reinitialize_linear_system();
  
@@ -110,6 +114,12 @@ public:
   bool isInit_;
   bool collocationForViscousTerms_;
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
+
+  // cleared by bcs whose operator depends on the temperature or on transfers
+  bool linearBCs_;
+  // time step and gamma1 of the last assembled LHS; negative before the first
+  double lhsTimeStep_;
+  double lhsGamma1_;
 };
 
 } // namespace nalu
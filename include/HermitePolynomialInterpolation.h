@@ -28,6 +28,14 @@ public:
     const double *elemNodalDqdx, 
     const double *haloCoord,
     double &interpResult) = 0;
+
+  // weights of the nodal values and gradient components (the layout of
+  // elemNodalQ followed by elemNodalDqdx) that reproduce do_hermite at haloCoord
+  virtual int num_weights() const = 0;
+  virtual void hermite_weights(
+    const double *elemNodalCoords,
+    const double *haloCoord,
+    double *weights) = 0;
 };
 
 class HermitePolynomialInterpolationFourPoint : public HermitePolynomialInterpolation
@@ -42,6 +50,14 @@ public:
     const double *elemNodalDqdx, 
     const double *haloCoord,
     double &interpResult);
+  int num_weights() const { return 12; }
+  void hermite_weights(
+    const double *elemNodalCoords,
+    const double *haloCoord,
+    double *weights);
+
+  void load_matrix(const double *elemNodalCoords);
+  void basis(const double *haloCoord, double *p);
 
   int numberPoints_;
   Teuchos::SerialDenseMatrix<int, double> A_;
@@ -62,6 +78,14 @@ public:
     const double *elemNodalDqdx,
     const double *haloCoord,
     double &interpResult);
+  int num_weights() const { return 32; }
+  void hermite_weights(
+    const double *elemNodalCoords,
+    const double *haloCoord,
+    double *weights);
+
+  void load_matrix(const double *elemNodalCoords);
+  void basis(const double *haloCoord, double *p);
 
   int numberPoints_;
   Teuchos::SerialDenseMatrix<int, double> A_;
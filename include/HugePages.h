@@ -0,0 +1,59 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef HugePages_h
+#define HugePages_h
+
+#include <cstddef>
+#include <string>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// 2MB page backing of large arrays; Linux only, no-ops elsewhere.
+//
+// stk buckets and Tpetra matrices and vectors come from the allocators of
+// those libraries, so their memory is advised (madvise MADV_HUGEPAGE) once
+// it exists and the kernel backs it with transparent huge pages. Storage
+// Nalu allocates itself (the tabular property spline data) comes from
+// allocate_huge_pages(), which maps explicit huge pages (hugetlbfs) when
+// asked for and available.
+//
+// modes: "none", "transparent" or "explicit"; the NALU_HUGE_PAGES
+// environment variable takes precedence over the input deck
+void set_huge_page_mode(const std::string &mode);
+const std::string &huge_page_mode();
+bool huge_pages_active();
+
+// advise the 2MB regions overlapping [begin, begin+bytes); regions advised
+// before are skipped. The number of regions newly advised
+size_t advise_huge_pages(
+  const void *begin,
+  const size_t bytes);
+
+// field data of all buckets of all ranks
+size_t advise_field_huge_pages(
+  stk::mesh::BulkData &bulkData);
+
+// anonymous mapping rounded up to 2MB; explicit huge pages first in the
+// explicit mode, else advised. Release with free_huge_pages(p, bytes)
+void *allocate_huge_pages(const size_t bytes);
+void free_huge_pages(
+  void *p,
+  const size_t bytes);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -11,13 +11,23 @@
 
 #include <Realm.h>
 
+// stk
+#include <stk_mesh/base/Entity.hpp>
+
 // standard c++
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <stdint.h>
 #include <utility>
 
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
 namespace YAML {
 class Node;
 }
@@ -64,16 +74,58 @@ public:
   double compute_adaptive_time_step() { return 1.0e8; }
   void swap_states() {}
   void predict_state() {}   
-  void pre_timestep_work() {}  
+  void pre_timestep_work();
   void output_banner() {}
   void advance_time_step() {}
   double populate_restart( double &timeStepNm1, int &timeStepCount);
+  void populate_variables_from_input();
  
   // internal calls
   void register_io_fields();
 
   // hold the field information
   std::vector<InputOutputInfo *> inputOutputFieldInfo_;
+
+  // input_variables_from_file follow the simulation time: the database
+  // steps bracketing it are held and interpolated, and the step after them
+  // is read on a background thread while they are in use
+  bool timeDependentInput_;
+  bool backgroundInput_;
+
+private:
+
+  // fields, database node order and step times of the time-dependent input
+  void setup_time_levels();
+
+  // values of all input fields at a database step (one-based), in database
+  // node order
+  void read_time_level(
+    const int step,
+    std::vector<std::vector<double> > &values);
+
+  // held steps bracket the time; the prefetched one is taken when it fits
+  void advance_time_levels(
+    const double time);
+
+  // fields at the time from the held steps
+  void interpolate_time_levels(
+    const double time);
+
+  void start_prefetch(
+    const int step);
+  void complete_prefetch();
+
+  std::vector<stk::mesh::FieldBase *> inputFields_;
+  std::vector<std::string> inputFieldDbNames_;
+  std::vector<stk::mesh::Entity> inputNodes_;
+  std::vector<double> stepTimes_;
+
+  // the two held steps (earlier first) and the step being prefetched; 0: none
+  int levelStep_[2];
+  std::vector<std::vector<double> > levelValues_[2];
+  int prefetchStep_;
+  std::vector<std::vector<double> > prefetchValues_;
+  std::thread prefetchThread_;
 };
 
 } // namespace nalu
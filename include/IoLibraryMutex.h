@@ -0,0 +1,25 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef IoLibraryMutex_h
+#define IoLibraryMutex_h
+
+#include <mutex>
+
+namespace sierra{
+namespace nalu{
+
+// Ioss and the libraries below it (exodus, netCDF, HDF5) are not thread
+// safe; database access off the main thread holds this lock, as do the
+// output and restart writes of the realms
+std::mutex & io_library_mutex();
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -27,6 +27,9 @@
 
 #include <Ifpack2_Factory.hpp>
 
+#include <map>
+#include <vector>
+
 // Header files defining default types for template parameters.
 // These headers must be included after other MueLu/Xpetra headers.
 typedef double                                                        Scalar;
@@ -150,22 +153,34 @@ class TpetraLinearSolver : public LinearSolver
   
     void setSystemObjects(
       Teuchos::RCP<LinSys::Matrix> matrix,
-      Teuchos::RCP<LinSys::Vector> rhs);
+      Teuchos::RCP<LinSys::MultiVector> rhs);
 
+    // sln and rhs may hold several columns (components sharing the matrix)
     void setupLinearSolver(
-      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::MultiVector> sln,
       Teuchos::RCP<LinSys::Matrix> matrix,
-      Teuchos::RCP<LinSys::Vector> rhs,
+      Teuchos::RCP<LinSys::MultiVector> rhs,
       Teuchos::RCP<LinSys::MultiVector> coords);
 
+    // block (BlockCrsMatrix) systems; relaxation preconditioning only
+    void setupLinearSolver(
+      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::BlockMatrix> matrix,
+      Teuchos::RCP<LinSys::Vector> rhs);
+
+    // Belos applies op in place of the matrix (e.g., MatrixFreeOperator);
+    // the preconditioners are still built on the matrix
+    void setOperator(Teuchos::RCP<LinSys::Operator> op);
+
     void destroyLinearSolver();
 
     void setMueLu();
 
-    int residual_norm(int whichNorm, Teuchos::RCP<LinSys::Vector> sln, double& norm);
+    // norm over all columns
+    int residual_norm(int whichNorm, Teuchos::RCP<LinSys::MultiVector> sln, double& norm);
 
     int solve(
-      Teuchos::RCP<LinSys::Vector> sln,
+      Teuchos::RCP<LinSys::MultiVector> sln,
       int & iterationCount,
       double & scaledResidual);
 
@@ -174,19 +189,108 @@ class TpetraLinearSolver : public LinearSolver
 
     bool & activeMueLu(){ return activateMueLu_; }
 
+    // matrix is unchanged since the last solve; skip preconditioner setup
+    bool & reuseLhs(){ return reuseLhs_; }
+
+    // LHS changed but the preconditioner of the previous solve is kept
+    bool & keepPreconditioner(){ return keepPreconditioner_; }
+
+    // sweep ordering of the next solve is cached under a non-negative tag
+    int & orderingTag(){ return orderingTag_; }
+
+    // current time step; drives the MueLu rebuild frequency
+    int & timeStepCount(){ return timeStepCount_; }
+
+    // convergence tolerance of the next solve (inexact Newton forcing term)
+    void setTolerance(const double tolerance);
+
+    // bytes held by the operators of all MueLu levels on this rank
+    size_t preconditionerBytes() const;
+
+    // cpu time of the preconditioner setup (zero when kept) and of the
+    // Krylov iterations of the last solve
+    double setupTime() const { return setupTime_; }
+    double applyTime() const { return applyTime_; }
+
+    // configs tried by the autotune, the solver's own config first
+    void setAutotuneCandidates(const std::vector<TpetraLinearSolverConfig *> &candidates);
+
+    // MueLu of the config or of one of the autotune candidates needs the
+    // nodal coordinates
+    bool needsCoordinates() const;
+
+    // prolongators of the upper MueLu levels, finest first, and the
+    // coordinates of their coarse nodes; taken over on the next hierarchy
+    // build, empty for algebraic aggregation throughout
+    void setProlongators(
+      const std::vector<Teuchos::RCP<LinSys::Matrix> > &prolongators,
+      const std::vector<Teuchos::RCP<LinSys::MultiVector> > &coarseCoords);
+
   private:
+    // MueLu hierarchy on matrix_ (or on its float copy) from scratch or by reuse
+    void createMueLu(Teuchos::ParameterList & mueluParams);
+    // xml file parameters with the repartition preset of the config on top
+    void loadMueLuParams(Teuchos::ParameterList & mueluParams);
+    void reuseMueLu();
+
+    // rows of matrix_ ordered such that each row follows the rows it couples to
+    void setSweepOrdering();
+
+    // Chebyshev max eigenvalue of the last estimate handed to the
+    // preconditioner, or cleared when a new estimate is due
+    void setChebyshevEigenvalue();
+    void cacheChebyshevEigenvalue();
+
+    // Ifpack2 preconditioner of the current config on matrix_, and the solver
+    void createPreconditioner();
+
+    // switch to another config; preconditioner and solver are rebuilt on
+    // the next solve
+    void useConfig(TpetraLinearSolverConfig *config);
+
+    // next candidate, or the fastest one once all have been timed
+    void autotune();
+
     TpetraLinearSolverConfig *config_;
-    const Teuchos::RCP<Teuchos::ParameterList> params_;
-    const Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
+    Teuchos::RCP<Teuchos::ParameterList> params_; // shared with the config until setTolerance
+    Teuchos::RCP<Teuchos::ParameterList> paramsPrecond_;
     Teuchos::RCP<LinSys::Matrix> matrix_;
-    Teuchos::RCP<LinSys::Vector> rhs_;
+    Teuchos::RCP<LinSys::RowMatrix> rowMatrix_; // matrix_ or the block matrix
+    Teuchos::RCP<LinSys::Operator> operator_; // applied by Belos when set; rowMatrix_ otherwise
+    Teuchos::RCP<LinSys::MultiVector> rhs_;
     Teuchos::RCP<LinSys::LinearProblem> problem_;
     Teuchos::RCP<LinSys::SolverManager> solver_;
     Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
     Teuchos::RCP<MueLu::TpetraOperator<SC,LO,GO,NO> > mueluPreconditioner_;
+    Teuchos::RCP<LinSys::SingleMatrix> singleMatrix_;
+    Teuchos::RCP<MueLu::TpetraOperator<LinSys::SingleScalar,LO,GO,NO> > mueluSinglePreconditioner_;
+    Teuchos::RCP<LinSys::Operator> mueluOperator_; // preconditioner seen by Belos
     Teuchos::RCP<LinSys::MultiVector> coords_;
+    std::vector<Teuchos::RCP<LinSys::Matrix> > prolongators_;
+    std::vector<Teuchos::RCP<LinSys::MultiVector> > coarseCoords_;
 
     bool activateMueLu_;
+    bool reuseLhs_;
+    bool keepPreconditioner_;
+    int orderingTag_;
+    std::map<int, Teuchos::ArrayRCP<LinSys::LocalOrdinal> > sweepOrderings_;
+    int timeStepCount_;
+    int mueluBuildStep_;
+    double lambdaMax_; // cached Chebyshev estimate; not positive when unknown
+    int lambdaStep_;
+    bool ownsParams_;
+    double setupTime_;
+    double applyTime_;
+
+    // autotune; cpu time and solves per candidate, unconverged solves rule
+    // a candidate out
+    std::vector<TpetraLinearSolverConfig *> autotuneConfigs_;
+    std::vector<double> autotuneTime_;
+    std::vector<int> autotuneSolves_;
+    std::vector<bool> autotuneFailed_;
+    size_t autotuneIndex_;
+    int autotuneStep_;
+    bool autotuneDone_;
 
 };
 
@@ -10,6 +10,7 @@
 #define LinearSolverConfig_h
 
 #include <string>
+#include <vector>
 #include <AztecOO.h>
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
@@ -74,6 +75,34 @@ class TpetraLinearSolverConfig {
     bool recomputePreconditioner() { return recomputePreconditioner_; }
     bool reusePreconditioner() { return reusePreconditioner_; }
     std::string get_method() {return method_;}
+    const std::string & muelu_reuse_policy() const {return mueluReusePolicy_;}
+    int muelu_rebuild_frequency() const {return mueluRebuildFrequency_;}
+    bool muelu_single_precision() const {return mueluSinglePrecision_;}
+    const Teuchos::RCP<Teuchos::ParameterList> & muelu_repartition_params() const {return mueluRepartitionParams_;}
+    bool muelu_report_levels() const {return mueluReportLevels_;}
+    int muelu_geometric_levels() const {return mueluGeometricLevels_;}
+    bool use_sweep_ordering() const {return useSweepOrdering_;}
+    bool use_block_matrix() const {return useBlockMatrix_;}
+    bool shared_component_matrix() const {return sharedComponentMatrix_;}
+    bool recycle_krylov_space() const {return recycleKrylovSpace_;}
+    double tolerance() const {return tolerance_;}
+    bool use_forcing_term() const {return useForcingTerm_;}
+    double forcing_term_max() const {return forcingTermMax_;}
+    double forcing_term_gamma() const {return forcingTermGamma_;}
+    double forcing_term_alpha() const {return forcingTermAlpha_;}
+    bool write_solver_log() const {return writeSolverLog_;}
+    int capture_step() const {return captureStep_;}
+    int capture_iteration() const {return captureIteration_;}
+    const std::string & capture_system() const {return captureSystem_;}
+    bool device_resident() const {return deviceResident_;}
+    bool matrix_free() const {return matrixFree_;}
+    bool persistent_fill() const {return persistentFill_;}
+    bool cache_value_offsets() const {return cacheValueOffsets_;}
+    const std::string & preconditioner_type() const {return preconditionerType_;}
+    bool use_chebyshev() const {return preconditionerType_ == "CHEBYSHEV";}
+    int eigenvalue_frequency() const {return eigenvalueFrequency_;}
+    const std::vector<std::string> & autotune_candidates() const {return autotuneCandidates_;}
+    int autotune_steps() const {return autotuneSteps_;}
 
   private:
     std::string name_;
@@ -90,6 +119,93 @@ class TpetraLinearSolverConfig {
     bool recomputePreconditioner_;
     bool reusePreconditioner_;
 
+    // MueLu hierarchy reuse across time steps: "rebuild" (governed by the
+    // recompute/reuse flags), "numeric_refresh" (keep aggregates and
+    // tentative prolongator) or "freeze_prolongators" (keep R and P); a
+    // full rebuild is forced every mueluRebuildFrequency_ time steps (0: never)
+    std::string mueluReusePolicy_;
+    int mueluRebuildFrequency_;
+
+    // MueLu hierarchy built and applied in float; Belos iterates in double
+    bool mueluSinglePrecision_;
+
+    // coarse level rebalance (Zoltan2) onto fewer ranks, "none" (left to the
+    // xml file), "coarse" or "aggressive"; the preset overrides the xml file
+    std::string mueluRepartition_;
+    Teuchos::RCP<Teuchos::ParameterList> mueluRepartitionParams_;
+
+    // rows, nonzeros and active ranks of each level after a hierarchy build
+    bool mueluReportLevels_;
+
+    // upper MueLu levels with prolongators from the uniform refinement
+    // hierarchy (percept family trees), aggregation below; 0: off
+    int mueluGeometricLevels_;
+
+    // orthogonalization and CG variants with fewer all-reduces per iteration
+    bool reduceCommunication_;
+
+    // Gauss-Seidel rows visited in the dependency (upwind) order of the matrix
+    bool useSweepOrdering_;
+
+    // multi-dof systems stored as a BlockCrsMatrix with numDof x numDof blocks
+    bool useBlockMatrix_;
+
+    // multi-dof systems stored as one scalar (node) matrix, the mean of the
+    // diagonal blocks, shared by all components; solved as a multivector
+    bool sharedComponentMatrix_;
+
+    // recycling solver (gcrodr); the deflation space of recycleSpace_ vectors
+    // persists across solves of the same linear system
+    bool recycleKrylovSpace_;
+    int recycleSpace_;
+
+    // Eisenstat-Walker (choice 2) linear tolerance, gamma*(r_k/r_k-1)^alpha,
+    // bounded by [tolerance_, forcingTermMax_]
+    double tolerance_;
+    bool useForcingTerm_;
+    double forcingTermMax_;
+    double forcingTermGamma_;
+    double forcingTermAlpha_;
+
+    // one csv row per solve, <linear system>.solver_log.csv
+    bool writeSolverLog_;
+
+    // binary capture (LinearSystemCapture.h) of the system solved at this
+    // time step and nonlinear iteration, <linear system>.step<N>.sys; -1 for
+    // none. An empty system name captures every system using the solver
+    int captureStep_;
+    int captureIteration_;
+    std::string captureSystem_;
+
+    // rhs stays in the Tpetra node memory space between device assembly,
+    // export and solve; synced to the host only on host access
+    bool deviceResident_;
+
+    // element systems applied element by element (MatrixFreeOperator); the
+    // assembled matrix only holds the nearest neighbour (reduced) stencil
+    // and serves the preconditioner
+    bool matrixFree_;
+
+    // the globally owned (shared row) matrix stays in fill over its static
+    // graph; only the owned matrix is fill completed each assembly
+    bool persistentFill_;
+
+    // element algorithms sum straight into the matrix values at offsets
+    // kept per element; memory of (nodes*dofs)^2 ints per element
+    bool cacheValueOffsets_;
+
+    // Ifpack2 preconditioner, "RELAXATION", "CHEBYSHEV" or "RILUK"; the Chebyshev
+    // max eigenvalue (power iteration on D^-1 A) is estimated once and reused,
+    // re-estimated every eigenvalueFrequency_ time steps (0: never)
+    std::string preconditionerType_;
+    int eigenvalueFrequency_;
+
+    // other tpetra solver blocks tried in turn, autotuneSteps_ time steps
+    // each, after this one; the fastest (mean time per converged solve) is
+    // kept for the rest of the run
+    std::vector<std::string> autotuneCandidates_;
+    int autotuneSteps_;
+
 };
 
 } // namespace nalu
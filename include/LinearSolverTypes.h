@@ -11,6 +11,8 @@
 
 #include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Experimental_BlockCrsMatrix.hpp>
+#include <Tpetra_Experimental_BlockMultiVector.hpp>
 
 // Forward declare templates
 namespace Teuchos {
@@ -91,6 +93,9 @@ typedef Teuchos::ArrayRCP<Scalar >                                         OneDV
 typedef Teuchos::ArrayRCP<const Scalar >                                   ConstOneDVector;
 typedef Tpetra::Vector<Scalar,LocalOrdinal,GlobalOrdinal,Node>             Vector;
 typedef Tpetra::CrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>       Matrix;
+typedef Tpetra::RowMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node>       RowMatrix;
+typedef Tpetra::Experimental::BlockCrsMatrix<Scalar, LocalOrdinal, GlobalOrdinal, Node> BlockMatrix;
+typedef Tpetra::Experimental::BlockMultiVector<Scalar, LocalOrdinal, GlobalOrdinal, Node> BlockMultiVector;
 typedef Tpetra::Operator<Scalar, LocalOrdinal, GlobalOrdinal, Node>        Operator;
 typedef Belos::MultiVecTraits<Scalar, MultiVector>                         MultiVectorTraits;
 typedef Belos::OperatorTraits<Scalar,MultiVector, Operator>                OperatorTraits;
@@ -98,6 +103,12 @@ typedef Belos::LinearProblem<Scalar, MultiVector, Operator>                Linea
 typedef Belos::SolverManager<Scalar, MultiVector, Operator>                SolverManager;
 typedef Belos::SolverFactory<Scalar, MultiVector, Operator>                SolverFactory;
 typedef Ifpack2::Preconditioner<Scalar, LocalOrdinal, GlobalOrdinal, Node> Preconditioner;
+
+// single precision preconditioner objects (mixed precision MueLu)
+typedef float  SingleScalar;
+typedef Tpetra::MultiVector<SingleScalar,LocalOrdinal,GlobalOrdinal,Node>  SingleMultiVector;
+typedef Tpetra::CrsMatrix<SingleScalar, LocalOrdinal, GlobalOrdinal, Node> SingleMatrix;
+typedef Tpetra::Operator<SingleScalar, LocalOrdinal, GlobalOrdinal, Node>  SingleOperator;
 };
 
 
@@ -10,6 +10,7 @@
 #define LinearSystem_h
 
 #include <LinearSolverTypes.h>
+#include <Enums.h>
 
 #include <Teuchos_RCP.hpp>
 #include <Tpetra_DefaultPlatform.hpp>
@@ -34,6 +35,7 @@ namespace nalu{
 
 class Realm;
 class LinearSolver;
+struct DeviceEdgeSystem;
 
 class LinearSystem
 {
@@ -61,6 +63,18 @@ public:
   virtual void buildOversetNodeGraph(const stk::mesh::PartVector & parts)=0; // overset->elem_node assembly
   virtual void finalizeLinearSystem()=0;
 
+  // re-derive the interface coupling (contact halo, non-conformal, overset)
+  // of a finalized system after mesh motion; false if a full rebuild is needed
+  virtual bool updateInterfaceGraph() { return false; }
+
+  // move the matrix and rhs pages to the NUMA domains of the threads that
+  // work on their rows; the pages placed
+  virtual size_t placePages() { return 0; }
+
+  // advise the matrix and vector storage for huge pages (HugePages.h); the
+  // 2MB regions advised
+  virtual size_t adviseHugePages() { return 0; }
+
   // Matrix Assembly
   virtual void zeroSystem()=0;
 
@@ -73,6 +87,38 @@ public:
     const char *trace_tag=0
     )=0;
 
+  // the element system of elem over its nodes; a system may keep the matrix
+  // offsets of each element. The default is a plain sumInto
+  virtual void sumIntoElem(
+    const stk::mesh::Entity elem,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
+  // rows of the first numRowObj entities only, e.g., constraint rows; rhs
+  // holds numRowObj*numDof entries and lhs those rows over the columns of
+  // all entities (row major). The default pads to a full sumInto
+  virtual void sumIntoRows(
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    const size_t numRowObj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
+  // single-dof assembly in the Kokkos execution space of the Tpetra node;
+  // row offsets of the nodes and the local matrices/rhs between begin and
+  // end. false when the system is blocked, multi-dof or not Tpetra
+  virtual bool deviceRowOffsets(
+    const std::vector<stk::mesh::Entity> &nodes,
+    std::vector<int> &rowOffsets) { return false; }
+  virtual bool beginDeviceAssembly(DeviceEdgeSystem &deviceSystem) { return false; }
+  virtual void endDeviceAssembly() {}
+
   virtual void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -80,6 +126,16 @@ public:
     const unsigned beginPos,
     const unsigned endPos)=0;
 
+  // Dirichlet rows of a component of a coupled system (CoupledComponentLinearSystem);
+  // field components beginPos..endPos set the dofs from dofOffset+beginPos
+  virtual void applyCoupledDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned dofOffset);
+
   virtual void prepareConstraints(
     const unsigned beginPos,
     const unsigned endPos)=0;
@@ -90,6 +146,15 @@ public:
 
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
+
+  // bytes held on this rank by the graph, matrix values, vectors and preconditioner
+  virtual void memoryUsage(
+    size_t &graphBytes,
+    size_t &matrixBytes,
+    size_t &vectorBytes,
+    size_t &preconditionerBytes) const
+  { graphBytes = matrixBytes = vectorBytes = preconditionerBytes = 0; }
+
   unsigned numDof() const { return numDof_; }
   const int & linearSolveIterations() {return linearSolveIterations_; }
   const double & linearResidual() {return linearResidual_; }
@@ -99,6 +164,21 @@ public:
   const std::string name() { return name_; }
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+
+  // keep the assembled LHS (and preconditioner); only the RHS is assembled
+  bool & reuseLhs() {return reuseLhs_;}
+  bool lhsAssembled() const {return lhsAssembled_;}
+
+  // apply the preconditioner of the previous solve although the LHS changed
+  bool & keepPreconditioner() {return keepPreconditioner_;}
+
+  // a sweep preconditioner caches the row ordering of a solve under this
+  // tag (e.g., the ordinate); negative tags recompute it every solve
+  int & orderingTag() {return orderingTag_;}
+
+  // initial guess built from the increments of previous time steps
+  InitialGuessType & initialGuessType() {return initialGuessType_;}
+  int & initialGuessHistory() {return initialGuessHistory_;}
 protected:
   virtual void beginLinearSystemConstruction()=0;
   virtual void checkError(
@@ -122,6 +202,12 @@ protected:
   double scaledNonLinearResidual_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool reuseLhs_;
+  bool lhsAssembled_;
+  bool keepPreconditioner_;
+  int orderingTag_;
+  InitialGuessType initialGuessType_;
+  int initialGuessHistory_;
 
 public:
   bool provideOutput_;
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef LinearSystemCapture_h
+#define LinearSystemCapture_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_RCP.hpp>
+
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+// binary snapshot of an assembled (point) system for offline solver runs;
+// one file for all ranks, written and read with MPI-IO.
+//
+// layout: a header (magic "NALUCAP1", number of ranks, numDof, number of rhs
+// columns, spatial dimension, 64 character system name) and the byte offsets
+// of the rank sections, then per rank: number of rows and of entries, the
+// global row ids, CSR row pointers, global column ids, values, rhs (column
+// by column) and the coordinates of each row (nDim columns). Integers are
+// 64 bit and all data is in the byte order of the writer
+struct LinearSystemCapture
+{
+  std::string name_;
+  int numDof_;
+  Teuchos::RCP<LinSys::Matrix> matrix_;
+  Teuchos::RCP<LinSys::MultiVector> rhs_;
+  Teuchos::RCP<LinSys::MultiVector> coords_;
+};
+
+// collective over the communicator of the matrix
+void write_linear_system_capture(
+  const std::string &fileName,
+  const std::string &systemName,
+  const int numDof,
+  const LinSys::Matrix &matrix,
+  const LinSys::MultiVector &rhs,
+  const LinSys::MultiVector &coords);
+
+// collective; any number of ranks, each takes a contiguous range of the
+// rank sections of the writer
+LinearSystemCapture read_linear_system_capture(
+  const std::string &fileName,
+  const Teuchos::RCP<LinSys::Comm> &comm);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
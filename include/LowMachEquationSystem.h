@@ -21,6 +21,7 @@ namespace sierra{
 namespace nalu{
 
 class AlgorithmDriver;
+class ComputeMdotElemAlgorithm;
 class Realm;
 class AssembleNodalGradAlgorithmDriver;
 class AssembleNodalGradUAlgorithmDriver;
@@ -38,6 +39,8 @@ public:
     EquationSystems& equationSystems,
     const bool elementContinuityEqs);
   virtual ~LowMachEquationSystem();
+
+  virtual void load(const YAML::Node & node);
   
   virtual void initialize();
 
@@ -73,8 +76,17 @@ public:
 
   virtual void predict_state();
 
+  virtual void initial_work();
+
+  virtual void reinitialize_linear_system();
+
   void project_nodal_velocity();
 
+  // coupled (u,p) system; momentum and continuity assemble into it through
+  // component systems (CoupledComponentLinearSystem)
+  void create_coupled_linear_system();
+  void assemble_and_solve_coupled();
+
   void post_converged_work();
 
   const bool elementContinuityEqs_; /* allow for mixed element/edge for continuity */
@@ -89,6 +101,14 @@ public:
   SurfaceForceAndMomentAlgorithmDriver *surfaceForceAndMomentAlgDriver_;
 
   bool isInit_;
+
+  // continuity solve, mdot and projection repeated per momentum solve
+  // (PISO-type correctors); later correctors keep the continuity operator
+  int pressureCorrectors_;
+
+  // one (u,v,w,p) solve per nonlinear iteration in place of the projection
+  bool coupledVelocityPressure_;
+  GenericFieldType *uvwpTmp_;
      
 };
 
@@ -153,6 +173,12 @@ public:
 
   void compute_wall_function_params();
 
+  // max Courant/Reynolds; reduced from the assembly when fused
+  void compute_courant_reynolds();
+
+  // per-node pseudo time step from the local Courant number
+  void compute_local_time_step();
+
   virtual void manage_projected_nodal_gradient(
      EquationSystems& eqSystems);
    virtual void compute_projected_nodal_gradient();
@@ -168,6 +194,7 @@ public:
   ScalarFieldType *visc_;
   ScalarFieldType *tvisc_;
   ScalarFieldType *evisc_;
+  ScalarFieldType *localTimeStep_;
   
   AssembleNodalGradUAlgorithmDriver *assembleNodalGradAlgDriver_;
   AlgorithmDriver *diffFluxCoeffAlgDriver_;
@@ -179,6 +206,9 @@ public:
 
   double firstPNGResidual_;
 
+  // element Courant/Reynolds written by AssembleMomentumElemSolverAlgorithm
+  bool fuseCourantReynolds_;
+
   // saved of mesh parts that are not to be projected
   std::vector<stk::mesh::Part *> notProjectedPart_;
 };
@@ -247,6 +277,9 @@ public:
   virtual void manage_projected_nodal_gradient(
     EquationSystems& eqSystems);
   virtual void compute_projected_nodal_gradient();
+
+  // mdot following the pressure solve and update; fused when active
+  void compute_mdot_after_solve();
   
   const bool elementContinuityEqs_;
   const bool managePNG_;
@@ -260,6 +293,9 @@ public:
   AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
   AlgorithmDriver *computeMdotAlgDriver_;
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
+
+  // interior mdot algorithm with the fused update, if any; owned by the driver
+  ComputeMdotElemAlgorithm *fusedMdotAlg_;
 };
 
 } // namespace nalu
@@ -26,6 +26,7 @@ namespace nalu{
 class AlgorithmDriver;
 class Realm;
 class AssembleNodalGradAlgorithmDriver;
+class AssembleNodalGradMultiAlgorithmDriver;
 class LinearSystem;
 class EquationSystems;
 
@@ -91,6 +92,12 @@ public:
   void solve_and_update();
   void compute_nth_mass_fraction();
 
+  // one sweep for the nodal gradients of all solved mass fractions when
+  // every registered gradient algorithm has a multi-field counterpart
+  void setup_species_nodal_gradient();
+  void load_species_nodal_gradient(
+    const int k);
+
   bool system_is_converged();
   double provide_scaled_norm();
   double provide_norm();
@@ -100,12 +107,14 @@ public:
   GenericFieldType *massFraction_;
   ScalarFieldType *currentMassFraction_;
   VectorFieldType *dydx_;
+  GenericFieldType *dydxSpecies_;
   ScalarFieldType *yTmp_;
   ScalarFieldType *visc_;
   ScalarFieldType *tvisc_;
   ScalarFieldType *evisc_;
 
   AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
+  AssembleNodalGradMultiAlgorithmDriver *speciesNodalGradAlgDriver_;
   AlgorithmDriver *diffFluxCoeffAlgDriver_;
   
   bool isInit_;
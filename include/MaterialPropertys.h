@@ -54,6 +54,8 @@ public:
   Realm &realm_;
   MaterialPropertyVector materialPropertyVector_;
   std::string propertyTableName_;
+  bool propertyTableSingleReader_;
+  bool fusedPropertyEvaluation_;
 
   // vectors and maps required to manage full set of options
   std::vector<std::string> targetNames_;
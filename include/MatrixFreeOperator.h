@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MatrixFreeOperator_h
+#define MatrixFreeOperator_h
+
+#include <LinearSolverTypes.h>
+
+#include <Tpetra_MultiVector.hpp>
+#include <Tpetra_Operator.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+// unassembled (element by element) view of a point system; the element
+// matrices handed to sumInto are kept and applied on the fly, so the full
+// P2 stencil is never stored in a CrsMatrix. Rows follow the local row
+// numbering of TpetraLinearSystem: owned rows [0,numOwnedRows) and
+// globally owned (shared) rows [numOwnedRows,numRows); shared row sums
+// travel to their owner through the exporter, as in loadComplete
+class MatrixFreeOperator : public LinSys::Operator
+{
+public:
+
+  MatrixFreeOperator(
+    Teuchos::RCP<const LinSys::Map> ownedMap,
+    Teuchos::RCP<const LinSys::Map> globallyOwnedMap,
+    Teuchos::RCP<LinSys::Import> importer,
+    Teuchos::RCP<LinSys::Export> exporter,
+    const int numThreads);
+  virtual ~MatrixFreeOperator();
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const;
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const;
+
+  // Y = beta*Y + alpha*A*X
+  void apply(
+    const LinSys::MultiVector &X,
+    LinSys::MultiVector &Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const;
+
+  bool hasTransposeApply() const;
+
+  // drop all element matrices; row replacements are reset
+  void zero();
+
+  // store a numRows x numRows element matrix (row major); rows are local row
+  // ids in the element order of lhs
+  void sum_into(
+    const int threadId,
+    const size_t numRows,
+    const LinSys::LocalOrdinal *rows,
+    const double *lhs);
+
+  // row localId becomes diagonalValue*x; element contributions are dropped
+  void replace_row(
+    const LinSys::LocalOrdinal localId,
+    const double diagonalValue);
+
+  // bytes of the stored element matrices and row ids
+  size_t bytes() const;
+
+private:
+
+  // element matrices of one assembly thread, stored back to back
+  struct ElementBlocks {
+    std::vector<size_t> rowBegin_;
+    std::vector<size_t> lhsBegin_;
+    std::vector<LinSys::LocalOrdinal> rows_;
+    std::vector<double> lhs_;
+  };
+
+  Teuchos::RCP<const LinSys::Map> ownedMap_;
+  Teuchos::RCP<const LinSys::Map> globallyOwnedMap_;
+  Teuchos::RCP<LinSys::Import> importer_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+  const LinSys::LocalOrdinal numOwnedRows_;
+  const LinSys::LocalOrdinal numRows_;
+
+  std::vector<ElementBlocks> blocks_;
+
+  // replaced rows: A*x of the row is scaled by rowScale_ (0 or 1) and
+  // rowDiagonal_*x is added
+  std::vector<double> rowScale_;
+  std::vector<double> rowDiagonal_;
+
+  // shared entries of x and of A*x
+  mutable Teuchos::RCP<LinSys::Vector> xShared_;
+  mutable Teuchos::RCP<LinSys::Vector> yShared_;
+  mutable Teuchos::RCP<LinSys::Vector> yOwned_;
+  mutable std::vector<double> x_;
+  mutable std::vector<double> y_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,75 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MemoryCheckpoint_h
+#define MemoryCheckpoint_h
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// diskless restart; every state of the restart fields on the locally owned
+// and shared entities, and a few global values, packed into one buffer per
+// rank. With buddy copies the buffer is also held by the next rank, so that
+// the data of a lost rank survives in the memory of its partner. Entities
+// are matched by global id on restore; the mesh must not have changed
+class MemoryCheckpoint
+{
+public:
+
+  MemoryCheckpoint(
+    stk::mesh::BulkData &bulkData,
+    const bool buddy);
+  ~MemoryCheckpoint();
+
+  // collective when buddy copies are kept
+  void store(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    const std::vector<double> &globals);
+
+  // fields from the local copy; false when nothing was stored
+  bool restore(
+    const std::vector<stk::mesh::FieldBase *> &fields,
+    std::vector<double> &globals) const;
+
+  // collective; the partner of lostRank hands its buddy copy back, e.g.,
+  // to a replacement process, which then calls restore. Without a fault
+  // tolerant MPI the replacement is a restarted job on the same ranks
+  void recover(const int lostRank);
+
+  bool has_checkpoint() const { return !local_.empty(); }
+
+  // bytes of the local and the buddy copy on this rank
+  size_t bytes() const;
+
+private:
+
+  stk::mesh::BulkData &bulkData_;
+  const bool buddy_;
+  MPI_Comm comm_;
+
+  // [numGlobals, globals, per field state: numEntities,
+  //  per entity: id bits, numScalars, scalars]
+  std::vector<double> local_;
+  std::vector<double> partner_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
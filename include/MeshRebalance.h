@@ -0,0 +1,85 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MeshRebalance_h
+#define MeshRebalance_h
+
+#include <NaluParsing.h>
+#include <FieldTypeDef.h>
+
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// MeshRebalance
+//=============================================================================
+/**
+ * * @par Description:
+ * - weighted repartition of the elements when the estimated assembly cost
+ *   becomes unbalanced, e.g., after adaptivity or overset hole cutting.
+ *
+ * @par Design Considerations:
+ * - the cost of an element is one when active, inactive_weight when it is an
+ *   overset hole or adapted parent, plus non_conformal_weight per gauss point
+ *   of its non-conformal faces and overset_orphan_weight per orphan node it
+ *   shares. The weights live in an element field that stk_balance uses as
+ *   vertex weights; the Realm re-initializes everything after a migration.
+ */
+//=============================================================================
+class MeshRebalance
+{
+public:
+
+  MeshRebalance(
+    Realm &realm,
+    const YAML::Node &node);
+  ~MeshRebalance();
+
+  // load all of the options
+  void load(
+    const YAML::Node & node);
+
+  // register the element weight field
+  void setup();
+
+  // evaluate the element weights; true when max/avg cost exceeds the limit
+  bool needs_rebalance();
+
+  // migrate the elements with the current weights
+  void execute();
+
+  // hold the realm
+  Realm &realm_;
+
+  // check every checkFrequency_ steps; rebalance when above imbalanceLimit_
+  int checkFrequency_;
+  double imbalanceLimit_;
+
+  // stk_balance method, e.g., parmetis or rcb
+  std::string decompMethod_;
+
+  // element cost model
+  double inactiveWeight_;
+  double nonConformalWeight_;
+  double oversetOrphanWeight_;
+
+  ScalarFieldType *elementWeight_;
+  double imbalance_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,68 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MixedPrecisionOperator_h
+#define MixedPrecisionOperator_h
+
+#include <LinearSolverTypes.h>
+
+#include <Tpetra_MultiVector.hpp>
+#include <Tpetra_Operator.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+namespace sierra{
+namespace nalu{
+
+// double precision view of a single precision operator (e.g., a MueLu
+// hierarchy built on a float copy of the matrix); vectors are converted to
+// float on entry and back to double on exit of apply
+class MixedPrecisionOperator : public LinSys::Operator
+{
+public:
+
+  MixedPrecisionOperator(
+    Teuchos::RCP<LinSys::SingleOperator> singleOperator);
+  virtual ~MixedPrecisionOperator();
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const;
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const;
+
+  // Y = beta*Y + alpha*op(X)
+  void apply(
+    const LinSys::MultiVector &X,
+    LinSys::MultiVector &Y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const;
+
+  bool hasTransposeApply() const;
+
+  // entry-wise copies between precisions; maps must match
+  static void copy(
+    const LinSys::MultiVector &from,
+    LinSys::SingleMultiVector &to);
+  static void copy(
+    const LinSys::SingleMultiVector &from,
+    LinSys::MultiVector &to,
+    const LinSys::Scalar alpha,
+    const LinSys::Scalar beta);
+
+private:
+
+  Teuchos::RCP<LinSys::SingleOperator> singleOperator_;
+
+  // float scratch; reallocated when the number of vectors changes
+  mutable Teuchos::RCP<LinSys::SingleMultiVector> xSingle_;
+  mutable Teuchos::RCP<LinSys::SingleMultiVector> ySingle_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -39,6 +39,8 @@ public:
     MasterElement *meSCS,
     MasterElement *meSCV);
 
+  virtual unsigned elem_data_requests() const;
+
   virtual void elem_execute(
     double *lhs,
     double *rhs,
@@ -34,6 +34,13 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node);
+
+  virtual void node_bucket_execute(
+    double *lhs,
+    double *rhs,
+    const int lhsSize,
+    const int rhsSize,
+    const stk::mesh::Bucket &b);
   
   VectorFieldType *velocityNm1_;
   VectorFieldType *velocityN_;
@@ -41,6 +41,7 @@ public:
   ScalarFieldType *densityNp1_;
   VectorFieldType *dpdx_;
   ScalarFieldType *dualNodalVolume_;
+  ScalarFieldType *localTimeStep_;
 
   double dt_;
   int nDim_;
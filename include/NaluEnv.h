@@ -12,6 +12,7 @@
 #include <mpi.h>
 #include <fstream>
 #include <streambuf>
+#include <vector>
 
 namespace sierra{
 namespace nalu{
@@ -33,6 +34,20 @@ class NaluEnv
   MPI_Comm parallelCommunicator_;
   int pSize_;
   int pRank_;
+
+  // ensemble of independent simulations in one run; each member has its
+  // own parallelCommunicator_, split from worldCommunicator_
+  MPI_Comm worldCommunicator_;
+  int ensembleMember_;
+  int ensembleSize_;
+  bool ensembleSharedSetup_;
+
+  // angular groups: replicas of the simulation, each on its own
+  // parallelCommunicator_, that share out the radiation ordinates;
+  // angularCommunicator_ joins the ranks of equal rank in each group
+  MPI_Comm angularCommunicator_;
+  int angularGroup_;
+  int angularGroupSize_;
   std::ostream *naluLogStream_;
   std::ostream *naluParallelStream_;
   
@@ -47,6 +62,39 @@ class NaluEnv
   int parallel_rank();
   void set_log_file_stream(std::string naluLogName);
   void close_log_file_stream();
+
+  // split the processes into numMembers contiguous, near-equal groups; this
+  // process becomes a rank of its group. With sharedSetup, the members make
+  // the same read-only setup calls (property tables) and do them together
+  void set_ensemble(const int numMembers, const bool sharedSetup);
+  int ensemble_member();
+  int ensemble_size();
+
+  // communicator of read-only setup shared by the ensemble members; the
+  // parallel communicator without an ensemble or shared setup
+  MPI_Comm shared_setup_comm();
+  bool ensemble_shared_setup();
+
+  // split the processes (of the ensemble member) into numGroups contiguous,
+  // equal groups that each hold the whole mesh; the groups must decompose it
+  // alike, so the process count must divide evenly
+  void set_angular_groups(const int numGroups);
+  int angular_group();
+  int angular_group_size();
+  MPI_Comm angular_comm();
+
+  // the first angular group writes the files; the others are replicas
+  bool writes_files();
+
+  // a realm on a subset of the processes makes its communicator the
+  // parallel one while it works; see RealmCommScope
+  void push_parallel_comm(MPI_Comm comm);
+  void pop_parallel_comm();
+  std::vector<MPI_Comm> parallelCommStack_;
+
+  // processes of the parallel communicator per shared memory node; the
+  // smallest over the nodes, and the number of nodes
+  void node_layout(int &ranksPerNode, int &numNodes);
 };
 
 } // namespace nalu
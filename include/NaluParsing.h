@@ -211,6 +211,9 @@ struct InflowUserData : public UserData {
   SpecDissRate sdr_;
   MixtureFraction mixFrac_;
   MassFraction massFraction_;
+
+  // plane samples of a precursor run; see the precursor_plane user function
+  std::string precursorFileName_;
  
   bool uSpec_;
   bool tkeSpec_;
@@ -270,6 +273,7 @@ struct OversetUserData : public UserData {
   double percentOverlap_;
   bool clipIsoParametricCoords_;
   bool detailedOutput_;
+  bool incrementalDonorSearch_;
   std::string backgroundBlock_;
   std::string backgroundSurface_;
   std::string backgroundCutBlock_;
@@ -277,7 +281,7 @@ struct OversetUserData : public UserData {
   std::vector<std::string> oversetBlockVec_;
  OversetUserData()
    : UserData(),
-    percentOverlap_(10.0), clipIsoParametricCoords_(false), detailedOutput_(false), backgroundBlock_("na"),
+    percentOverlap_(10.0), clipIsoParametricCoords_(false), detailedOutput_(false), incrementalDonorSearch_(false), backgroundBlock_("na"),
     backgroundSurface_("na"), backgroundCutBlock_("na"), oversetSurface_("na")
     {} 
 };
@@ -306,11 +310,13 @@ struct NonConformalUserData : public UserData {
   double expandBoxPercentage_;
   bool clipIsoParametricCoords_;
   double searchTolerance_;
+  bool incrementalSearch_;
 
   NonConformalUserData()
     : UserData(),
       searchMethodName_("na"), expandBoxPercentage_(0.0),
-    clipIsoParametricCoords_(false), searchTolerance_(1.0e-16)
+    clipIsoParametricCoords_(false), searchTolerance_(1.0e-16),
+    incrementalSearch_(false)
   {}
 };
 
@@ -0,0 +1,62 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef NodeEdgeGraph_h
+#define NodeEdgeGraph_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// node-to-edge adjacency (CSR) of a set of locally owned edges; an edge
+// operator can then be gathered node by node, each node written by a single
+// thread, rather than scattered edge by edge
+class NodeEdgeGraph
+{
+public:
+
+  NodeEdgeGraph(
+    Realm &realm);
+  ~NodeEdgeGraph();
+
+  // rebuild if the mesh has been modified since the last call
+  void update(
+    const stk::mesh::Selector &selector);
+
+  size_t num_nodes() const { return nodes_.size(); }
+
+  // every node touched by a selected edge; edges of node i are in
+  // [offsets_[i], offsets_[i+1]) in edge bucket order
+  std::vector<stk::mesh::Entity> nodes_;
+  std::vector<size_t> offsets_;
+  std::vector<stk::mesh::Entity> edges_;
+  std::vector<stk::mesh::Entity> otherNodes_;
+  // +1 when the node is the left node of the edge (area vector points away)
+  std::vector<double> signs_;
+
+private:
+
+  void build(
+    const stk::mesh::Selector &selector);
+
+  Realm &realm_;
+  size_t syncCount_;
+  size_t numBuckets_;
+  bool isBuilt_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -14,8 +14,11 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <DgInfo.h>
+#include <FieldTypeDef.h>
 
 // stk
+#include <stk_mesh/base/Entity.hpp>
 #include <stk_mesh/base/Part.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
 
@@ -36,7 +39,6 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class DgInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -69,7 +71,8 @@ class NonConformalInfo {
     const double expandBoxPercentage,
     const std::string &searchMethodName,
     const bool clipIsoParametricCoords,
-    const double searchTolerance);
+    const double searchTolerance,
+    const bool incrementalSearch = false);
 
   ~NonConformalInfo();
 
@@ -81,6 +84,32 @@ class NonConformalInfo {
   void complete_search();
   void provide_diagnosis();
 
+  // incremental search; record the opposing faces of the last search before the ghosting goes
+  void save_previous_search();
+
+  // ghost the opposing faces used by other processors last search along with their neighbours
+  void ghost_previous_opposing_faces();
+
+  // search the previous opposing face and its node neighbours of each gauss point
+  void warm_start_search();
+
+  // true if any gauss point was not found near its previous opposing face; collective
+  bool needs_fallback_search();
+
+  // full coarse search for the gauss points the warm start did not find
+  void search_unresolved();
+
+  // load the nodal coordinates of a candidate opposing face; returns its master element
+  MasterElement *gather_opposing_face(
+    stk::mesh::Entity opposingFace,
+    VectorFieldType *coordinates);
+
+  // isInElement for the gathered opposing face; keeps it if closer than the current best
+  void evaluate_opposing_face(
+    DgInfo *dgInfo,
+    stk::mesh::Entity opposingFace,
+    MasterElement *meFC);
+
   Realm &realm_;
   const std::string name_;
 
@@ -102,16 +131,37 @@ class NonConformalInfo {
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
+  /* start the search from the opposing faces of the last search */
+  const bool incrementalSearch_;
+  bool searched_;
+  bool warmStart_;
+
   /* bounding box data types for stk_search */
   std::vector<boundingPoint>      boundingPointVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
 
-  /* vector of DgInfo */
+  /* contiguous DgInfo storage, one per locally owned gauss point in face order */
+  std::vector<DgInfo> dgInfoPool_;
+
+  /* vector of DgInfo per face; points into dgInfoPool_ */
   std::vector<std::vector<DgInfo *> > dgInfoVec_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
+  /* gauss points left to the coarse search */
+  std::vector<DgInfo *> searchDgInfoVec_;
+
+  /* current face global id to the opposing face global id of each of its gauss points */
+  std::map<uint64_t, std::vector<uint64_t> > previousOpposingFaces_;
+
+  /* locally owned opposing faces used by each processor in the last search */
+  std::vector<std::vector<uint64_t> > previousFacesUsedBy_;
+
+  /* scratch for evaluate_opposing_face */
+  std::vector<double> ws_face_coordinates_;
+  std::vector<double> ws_opposing_iso_par_coords_;
+
 };
 
 } // end sierra namespace
@@ -13,6 +13,7 @@
 
 #include <string>
 #include <set>
+#include <vector>
 
 namespace Ioss{
   class PropertyManager;
@@ -21,6 +22,20 @@ namespace Ioss{
 namespace sierra{
 namespace nalu{
 
+// a subset of parts written to its own results database
+struct OutputRegion
+{
+  OutputRegion() : outputFreq_(1), outputStart_(0), fileIndex_(0) {}
+
+  std::string name_;
+  std::string outputDBName_;
+  int outputFreq_;
+  int outputStart_;
+  std::vector<std::string> targetNames_;
+  std::set<std::string> outputFieldNameSet_;
+  size_t fileIndex_;
+};
+
 class OutputInfo
 {
 public:
@@ -36,12 +51,19 @@ public:
   
   int get_restart_compression();
   bool get_restart_shuffle();
+
+  // settle io_aggregation once the output and restart blocks are read
+  void setup_io_aggregation();
   
   std::string outputDBName_;
   int outputFreq_;
   int outputStart_;
   bool outputNodeSet_; 
   int serializedIOGroupSize_;
+  // how the ranks share the writing of results and restart: none (a file
+  // per rank), composed (one file each, written collectively) or automatic
+  // (composed when the run spans nodes)
+  std::string ioAggregation_;
   bool hasOutputBlock_;
   bool hasRestartBlock_;
   bool activateRestart_;
@@ -56,6 +78,23 @@ public:
   bool outputCompressionShuffle_;
   int restartCompressionLevel_;
   bool restartCompressionShuffle_;
+  // bytes per real in the results database; 8 or 4
+  int outputRealSize_;
+  // steps between exodus flushes; 0 leaves the Ioss default (every step)
+  int outputFlushInterval_;
+  int restartFlushInterval_;
+  // one restart file written collectively by all ranks (netcdf4/HDF5)
+  bool restartCompose_;
+  // steps between in memory (diskless) checkpoints; 0 is off. The restart
+  // database above remains the occasional flush to disk
+  int memoryCheckpointFreq_;
+  // the checkpoint of each rank is also held by the next rank
+  bool memoryCheckpointBuddy_;
+  // a step with a non-finite system norm is repeated from the checkpoint
+  bool memoryCheckpointRollback_;
+  // element to edge ids in the restart database; a restart from it skips
+  // the edge creation search
+  bool restartEdgeConnectivity_;
 
   std::pair<bool, double> userWallTimeResults_;
   std::pair<bool, double> userWallTimeRestart_;
@@ -66,6 +105,20 @@ public:
 
   std::set<std::string> outputFieldNameSet_;
   std::set<std::string> restartFieldNameSet_;
+  // restart fields that are written but not read back; recomputed before use
+  std::set<std::string> restartSkipFieldNameSet_;
+
+  std::vector<OutputRegion> outputRegions_;
+
+  // in situ pipeline (ParaView Catalyst through the Ioss catalyst database);
+  // the script reduces the fields (slices, isosurfaces, statistics) in place
+  // of a full field output. No fields: those of the results output
+  bool hasInsitu_;
+  std::string insituScriptName_;
+  int insituFreq_;
+  int insituStart_;
+  std::set<std::string> insituFieldNameSet_;
+  Ioss::PropertyManager *insituPropertyManager_;
 
 };
 
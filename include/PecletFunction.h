@@ -9,6 +9,8 @@
 #ifndef PecletFunction_h
 #define PecletFunction_h
 
+#include <vector>
+
 namespace sierra{
 namespace nalu{
 
@@ -19,6 +21,8 @@ public:
   PecletFunction();
   virtual ~PecletFunction();
   virtual double execute(const double pecletNumber) = 0;
+  // array form; one virtual call for n evaluations
+  virtual void execute(const double *pecletNumber, double *pecletFactor, const int n);
   /*virtual void update_values(Realm *realm) = 0;*/
 };
 
@@ -28,6 +32,7 @@ public:
   ClassicPecletFunction(double A, double hf);
   virtual ~ClassicPecletFunction();
   double execute(const double pecletNumber);
+  void execute(const double *pecletNumber, double *pecletFactor, const int n);
   double A_;
   double hf_;
 };
@@ -35,13 +40,26 @@ public:
 class TanhPecletFunction : public PecletFunction
 {
 public:
-  TanhPecletFunction( double c1, double c2 );
+  // tableSize > 0 replaces std::tanh by linear interpolation in a table
+  TanhPecletFunction( double c1, double c2, int tableSize = 0 );
   virtual ~TanhPecletFunction();
   double execute(const double pecletNumber);
+  void execute(const double *pecletNumber, double *pecletFactor, const int n);
+  // bound on the difference between the tabulated and exact function
+  double table_error() const;
   double c1_; // peclet number at which transition occurs
   double c2_; // width of the transtion
   double shift_;
   double delta_;
+
+private:
+  double evaluate(const double pecletNumber) const;
+  double lookup(const double pecletNumber) const;
+
+  // table in (Pe-c1)/c2 over [-tableRange_, tableRange_], clipped outside
+  std::vector<double> table_;
+  double tableRange_;
+  double tableInvSpacing_;
 };
 
 } // namespace nalu
@@ -0,0 +1,94 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PerfRegion_h
+#define PerfRegion_h
+
+// hardware counter regions; compiled in with ENABLE_LIKWID (likwid marker
+// api, read with likwid-perfctr -m) or ENABLE_PAPI (PAPI high-level api,
+// papi_hl_output/ at exit). Both aggregate by region name. Otherwise the
+// regions are empty
+
+#if defined (NALU_USES_LIKWID)
+#include <likwid.h>
+#elif defined (NALU_USES_PAPI)
+#include <papi.h>
+#endif
+
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+// start/stop of the counters around a scope
+class PerfRegion
+{
+public:
+  explicit PerfRegion(
+    const std::string &name)
+#if defined (NALU_USES_LIKWID) || defined (NALU_USES_PAPI)
+    : name_(name)
+  {
+#if defined (NALU_USES_LIKWID)
+    LIKWID_MARKER_START(name_.c_str());
+#else
+    PAPI_hl_region_begin(name_.c_str());
+#endif
+  }
+#else
+  {}
+#endif
+
+  ~PerfRegion()
+  {
+#if defined (NALU_USES_LIKWID)
+    LIKWID_MARKER_STOP(name_.c_str());
+#elif defined (NALU_USES_PAPI)
+    PAPI_hl_region_end(name_.c_str());
+#endif
+  }
+
+private:
+#if defined (NALU_USES_LIKWID) || defined (NALU_USES_PAPI)
+  const std::string name_;
+#endif
+};
+
+// once per process, after MPI_Init and before MPI_Finalize
+inline void perf_regions_initialize()
+{
+#if defined (NALU_USES_LIKWID)
+  LIKWID_MARKER_INIT;
+#endif
+}
+
+inline void perf_regions_finalize()
+{
+#if defined (NALU_USES_LIKWID)
+  LIKWID_MARKER_CLOSE;
+#elif defined (NALU_USES_PAPI)
+  PAPI_hl_stop();
+#endif
+}
+
+// where the counters can be found; empty when no backend is compiled in
+inline const char *perf_regions_report()
+{
+#if defined (NALU_USES_LIKWID)
+  return "likwid marker regions; run under likwid-perfctr -m for the per-region counters";
+#elif defined (NALU_USES_PAPI)
+  return "PAPI regions; per-region counters are written to papi_hl_output/";
+#else
+  return "";
+#endif
+}
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
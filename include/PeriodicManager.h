@@ -63,6 +63,14 @@ class PeriodicManager {
     const bool &addSlaves = true,
     const bool &setSlaves = true);
 
+  // same for a set of fields; every exchange carries all of them
+  void apply_constraints(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true);
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
@@ -103,12 +111,12 @@ class PeriodicManager {
   /* communicate periodicGhosting nodes */
   void
   periodic_parallel_communicate_field(
-    stk::mesh::FieldBase *theField);
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
 
   /* communicate shared nodes and aura nodes */
   void
   parallel_communicate_field(
-    stk::mesh::FieldBase *theField);
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
 
   Realm &realm_;
   double searchTolerance_;
@@ -141,6 +149,7 @@ class PeriodicManager {
   // culmination of all searches
   SearchKeyVector searchKeyVector_;
 
+  // local master += slave and slave = master; the periodic ghosts must be current
   void add_slave_to_master(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
@@ -151,6 +160,10 @@ class PeriodicManager {
     const unsigned &sizeOfField,
     const bool &bypassFieldCheck);
 
+  // scratch for the single field apply_constraints
+  std::vector<stk::mesh::FieldBase *> singleFieldVec_;
+  std::vector<unsigned> singleSizeVec_;
+
 };
 
 } // namespace nalu
@@ -0,0 +1,95 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PlaneAveragingPostProcessing_h
+#define PlaneAveragingPostProcessing_h
+
+#include <NaluParsing.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <utility>
+
+// stk forwards
+namespace stk {
+  namespace mesh {
+    class FieldBase;
+    class Part;
+    typedef std::vector<Part*> PartVector;
+  }
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// PlaneAveragingPostProcessing
+//=============================================================================
+/**
+ * * @par Description:
+ * - in-situ averages of nodal fields over the planes of constant height
+ *   (e.g., ABL profiles of velocity, temperature and Reynolds stress).
+ *
+ * @par Design Considerations:
+ * - the distinct node heights of the target parts define the planes; each
+ *   owned node is binned once (rebuilt after mesh modification) so that a
+ *   sample is one bucket pass plus one all-reduce of the packed sums.
+ *   Nodes are weighted by their dual volume.
+ */
+//=============================================================================
+class PlaneAveragingPostProcessing
+{
+public:
+
+  PlaneAveragingPostProcessing(
+    Realm &realm,
+    const YAML::Node &node);
+  ~PlaneAveragingPostProcessing();
+
+  // load all of the options
+  void load(
+    const YAML::Node & node);
+
+  // planes and the plane index of each owned node
+  void build_bins();
+
+  // accumulate, reduce and write the profiles (if an output step)
+  void execute();
+
+  // hold the realm
+  Realm &realm_;
+
+  // frequency of output and the profile file (rank 0)
+  int outputFreq_;
+  std::string outputFileName_;
+  bool fileCreated_;
+
+  // coordinate along which planes are stacked and its merge tolerance
+  int axis_;
+  double heightTolerance_;
+
+  std::vector<std::string> targetNames_;
+  std::vector<std::pair<std::string, int> > fieldInfo_;
+  bool computeReynoldsStress_;
+
+  // plane heights and the plane of each owned node, in bucket order
+  std::vector<double> heights_;
+  std::vector<int> nodeBin_;
+  size_t syncCount_;
+  bool binsBuilt_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
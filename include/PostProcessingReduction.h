@@ -0,0 +1,99 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PostProcessingReduction_h
+#define PostProcessingReduction_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class PostProcessingReduction;
+
+// post processing whose output waits for the step's combined reduction
+class PostProcessingReductionClient {
+ public:
+  virtual ~PostProcessingReductionClient() {}
+  virtual void write_reduced(const PostProcessingReduction &reduction) = 0;
+};
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// PostProcessingReduction
+//=============================================================================
+/**
+ * * @par Description:
+ * - collects the global sums, minima and maxima of all post processing of
+ *   a step and completes them with a single MPI_Allreduce; the deferred
+ *   clients then write their output from the reduced values.
+ *
+ * @par Design Considerations:
+ * - contributions are packed as all sums, then all minima, then all
+ *   maxima into one MPI element; a user MPI_Op applies the matching
+ *   operation to each section.
+ *   Every rank must contribute the same sequence between completions.
+ */
+//=============================================================================
+class PostProcessingReduction {
+
+ public:
+
+  enum ReductionType {
+    REDUCE_SUM = 0,
+    REDUCE_MIN = 1,
+    REDUCE_MAX = 2
+  };
+
+  PostProcessingReduction(MPI_Comm comm);
+  ~PostProcessingReduction();
+
+  // queue numValues values; the handle reads the result after complete()
+  size_t contribute(
+    const double *values,
+    const unsigned numValues,
+    const ReductionType type);
+
+  // output of the client waits for complete()
+  void defer(PostProcessingReductionClient *client);
+
+  // reduce all contributions at once and let the deferred clients write
+  void complete();
+
+  // reduced values of a contribution; valid within write_reduced()
+  const double *result(const size_t handle) const;
+
+ private:
+
+  struct Contribution {
+    ReductionType type_;
+    size_t offset_;
+    unsigned numValues_;
+  };
+
+  MPI_Comm comm_;
+  MPI_Op reduceOp_;
+
+  std::vector<Contribution> contributionVec_;
+  std::vector<double> valueVec_[3];
+  std::vector<double> resultVec_[3];
+  std::vector<PostProcessingReductionClient *> clientVec_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -24,14 +24,19 @@
 #include <stk_util/util/ParameterList.hpp>
 
 // standard c++
+#include <mpi.h>
+
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include <stdint.h>
 
 namespace stk {
 namespace mesh {
 class Part;
+class Ghosting;
 }
 namespace io {
   class StkMeshIoBroker;
@@ -64,6 +69,16 @@ class PeriodicManager;
 class Realms;
 class Simulation;
 class SolutionOptions;
+struct DofNumerics;
+class ScratchArena;
+class AlgorithmTimers;
+class CommProfiler;
+class TpetraGraphRegistry;
+class ElemColoring;
+class TaskGraph;
+class SharedNodeFieldSum;
+class GhostedNodeFieldExchange;
+class PostProcessingReduction;
 class TimeIntegrator;
 class MasterElement;
 class PropertyEvaluator;
@@ -73,6 +88,10 @@ class Transfer;
 class SolutionNormPostProcessing;
 class TurbulenceAveragingPostProcessing;
 class DataProbePostProcessing;
+class PlaneAveragingPostProcessing;
+class MeshRebalance;
+class FaceGeometryCache;
+class MemoryCheckpoint;
 
 class Realm {
  public:
@@ -97,10 +116,27 @@ class Realm {
   bool debug() const;
   bool get_activate_memory_diagnostic();
   void provide_memory_summary();
+
+  // bytes per field, linear system and table with the high-water growth of each phase
+  void mark_memory_phase(const std::string &phase);
+  void provide_memory_breakdown();
+
+  // wall time and high-water mark at the end of each startup phase
+  void mark_startup_phase(const std::string &phase);
+  void provide_startup_summary();
+
+  // node field, matrix and rhs pages to the NUMA domains of the threads
+  void place_numa_pages();
+
+  // field, matrix and rhs storage to huge pages
+  void advise_storage_huge_pages();
   std::string convert_bytes(double bytes);
 
   void create_mesh();
 
+  // Ioss decomposition methods accepted for automatic_decomposition_type
+  static bool valid_decomposition_method(const std::string &method);
+
   void setup_adaptivity();
 
   void setup_nodal_fields();
@@ -113,6 +149,7 @@ class Realm {
   void enforce_bc_on_exposed_faces();
   void setup_initial_conditions();
   void setup_property();
+  void fuse_property_algorithms();
   void extract_universal_constant( 
     const std::string name, double &value, const bool useDefault);
   void augment_property_map(
@@ -124,6 +161,10 @@ class Realm {
   void initialize_global_variables();
 
   void create_output_mesh();
+  void create_output_region_meshes();
+  void provide_output_regions();
+  void create_insitu_mesh();
+  void provide_insitu_output();
   void create_restart_mesh();
   void input_variables_from_mesh();
 
@@ -132,13 +173,27 @@ class Realm {
   
   void augment_restart_variable_list(
       std::string restartFieldName);
+  // written to the restart database, but recomputed before use on a
+  // restart; not read back
+  void skip_restart_input(
+      const std::string restartFieldName);
 
   void create_edges();
   void provide_entity_count();
   void delete_edges();
+
+  // edges of a restart run from the element to edge ids of the restart
+  // database; no id negotiation. False when the database has none
+  bool uses_cached_edges();
+  void register_edge_connectivity();
+  bool create_edges_from_restart();
+  void fill_edge_connectivity();
   void commit();
 
   void process_mesh_motion();
+
+  // weighted migration of the elements followed by the re-initialization
+  void rebalance_mesh();
   void init_current_coordinates();
 
   std::string get_coordinates_name();
@@ -160,6 +215,14 @@ class Realm {
   void set_mesh_velocity(
     stk::mesh::Part *targetPart);
 
+  // rigid-body mesh motion; the geometry of the moving blocks is rotated
+  // with them rather than recomputed
+  bool has_rigid_body_motion();
+  void check_rigid_body_motion();
+  void rotate_geometry(
+    stk::mesh::Part *targetPart,
+    const double angle);
+
   // non-conformal-like algorithm suppoer
   void initialize_contact();
   void initialize_non_conformal();
@@ -172,6 +235,14 @@ class Realm {
   void output_converged_results();
   void provide_output();
   void provide_restart_output();
+  void provide_memory_checkpoint();
+
+  // restart fields and time parameters from the last in memory checkpoint
+  // (see populate_restart); returns the time of the checkpoint
+  double restore_memory_checkpoint(double &timeStepNm1, int &timeStepCount);
+
+  // a diverged step is repeated from the memory checkpoint
+  bool memory_checkpoint_rollback() const;
 
   void register_interior_algorithm(
     stk::mesh::Part *part);
@@ -223,6 +294,12 @@ class Realm {
     const unsigned &sizeOfTheField,
     const bool &bypassFieldCheck = true) const;
 
+  // several fields, each exchange carrying all of them
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase *> &fieldVec,
+    const std::vector<unsigned> &sizeOfFieldVec,
+    const bool &bypassFieldCheck = true) const;
+
   void periodic_delta_solution_update(
      stk::mesh::FieldBase *theField,
      const unsigned &sizeOfField) const;
@@ -238,6 +315,39 @@ class Realm {
     const unsigned sizeRow,
     const unsigned sizeCol);
 
+  // parallel_sum, periodic and overset update of an assembled nodal field;
+  // deferred to end_nodal_field_update_batch() when a batch is open
+  void nodal_field_update(
+    stk::mesh::FieldBase *theField,
+    const unsigned sizeOfField);
+
+  // batches nest; the outermost end exchanges all queued fields at once
+  void begin_nodal_field_update_batch();
+  void end_nodal_field_update_batch();
+
+  // between start and finish, nodal_field_update posts the shared node sum
+  // and returns; work that neither reads the fields on shared nodes nor
+  // writes them can run before finish completes the sums.  Periodic and
+  // overset realms, and open batches, keep the blocking update
+  void start_overlapped_nodal_field_updates();
+  void finish_overlapped_nodal_field_updates();
+
+  // ghosted field exchange that skips tracked fields not modified since
+  // their last exchange over the same ghosting; untracked fields always go
+  void communicate_ghosted_field_data(
+    const stk::mesh::Ghosting &ghosting,
+    const std::vector<const stk::mesh::FieldBase *> &fieldVec);
+
+  // opt a field into modification tracking; its writers must then mark it
+  void track_field_modification(const stk::mesh::FieldBase *theField);
+  void mark_field_modified(const stk::mesh::FieldBase *theField);
+
+  // mesh, ghosting or bulk data changes invalidate every tracked field
+  void mark_all_fields_modified();
+
+  // combined reduction of post processing; completed in post_converged_work
+  PostProcessingReduction &post_processing_reduction();
+
   virtual void populate_initial_condition();
   virtual void populate_boundary_data();
   virtual void boundary_data_to_state_data();
@@ -246,6 +356,8 @@ class Realm {
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
   virtual double compute_adaptive_time_step();
+  // relative max-norm of u^np1 less its linear extrapolation from n and nm1
+  double compute_temporal_error(const double r);
   virtual void swap_states();
   virtual void predict_state();
   virtual void pre_timestep_work();
@@ -255,6 +367,9 @@ class Realm {
   virtual void initial_work();
   
   void set_global_id();
+
+  // locality ordering of the owned nodes for the linear system rows
+  void set_node_ordering();
  
   /// check job for fitting in memory
   void check_job(bool get_node_count);
@@ -267,6 +382,25 @@ class Realm {
   MasterElement* get_volume_master_element(
     const stk::topology & theTopo);
 
+  // shared, topology-keyed work arrays for assembly algorithms
+  ScratchArena &get_scratch_arena() { return *scratchArena_; }
+  AlgorithmTimers &get_algorithm_timers() { return *algorithmTimers_; }
+
+  // message/byte counts of the parallel exchanges; NULL unless
+  // profile_communication is set
+  CommProfiler *get_comm_profiler() { return commProfiler_; }
+
+  // finalized Tpetra graphs shared by linear systems of identical connectivity
+  TpetraGraphRegistry &get_tpetra_graph_registry() { return *tpetraGraphRegistry_; }
+
+  // node-conflict colorings of all locally owned, active edges and elements;
+  // rebuilt on first use after create_edges (or any other mesh modification)
+  ElemColoring &get_edge_coloring();
+  ElemColoring &get_elem_coloring();
+
+  // handle to the resolved numerics of a dof
+  const DofNumerics &get_dof_numerics(
+    const std::string dofname);
   double get_hybrid_factor(
     const std::string dofname);
   double get_alpha_factor(
@@ -296,6 +430,8 @@ class Realm {
     const std::string dofname);
   double get_peclet_tanh_width(
     const std::string dofname);
+  int get_peclet_tanh_table_size(
+    const std::string dofname);
 
   // consistent mass matrix for projected nodal gradient
   bool get_consistent_mass_matrix_png(
@@ -305,8 +441,16 @@ class Realm {
   double get_mdot_interp();
   bool get_cvfem_shifted_mdot();
   bool get_cvfem_shifted_poisson();
+  bool get_cvfem_shifted_elem_assembly();
   bool get_cvfem_reduced_sens_poisson();
   
+  bool get_threaded_assembly();
+  bool get_device_edge_assembly();
+  bool get_device_property_evaluation();
+  bool get_cache_element_geometry();
+  // boundary face dndx shared by face algorithms; NULL unless geometry is cached
+  FaceGeometryCache *get_face_geometry_cache();
+
   bool has_nc_gauss_labatto_quadrature();
   NonConformalAlgType get_nc_alg_type();
   bool get_nc_alg_upwind_advection();
@@ -348,13 +492,29 @@ class Realm {
 
   Realms& realms_;
 
+  // processes [first, last] of the parent communicator run the realm, all of
+  // them when processor_range is absent. Realms on disjoint ranges advance
+  // concurrently; a rank outside the range holds the realm by name only.
+  // Collective over the parent communicator, before load
+  void setup_communicator(const YAML::Node & node);
+  bool on_this_rank() const;
+  bool has_rank_subset() const;
+  std::pair<int, int> processorRange_;
+  MPI_Comm realmComm_;
+
   std::string name_;
   std::string type_;
   std::string inputDBName_;
+  std::string inputDBType_;
   unsigned spatialDimension_;
 
   bool realmUsesEdges_;
   int solveFrequency_;
+  double subcycleTimeStepN_;
+  double subcycleTimeStepNm1_;
+  double subcycleGamma_[3];
+  double lastAdvanceTime_;
+  int numAdvances_;
   bool isTurbulent_;
   bool needsEnthalpy_;
 
@@ -370,6 +530,7 @@ class Realm {
 
   // nalu field data
   GlobalIdFieldType *naluGlobalId_;
+  GlobalIdFieldType *naluLocalOrder_;
 
   // algorithm drivers managed by region
   ComputeGeometryAlgorithmDriver *computeGeometryAlgDriver_;
@@ -381,7 +542,13 @@ class Realm {
   unsigned numInitialElements_;
   // for element, side, edge, node rank (node not used)
   stk::mesh::Selector adapterSelector_[4];
+  // bucket lists returned by get_buckets; dropped when the mesh changes
+  typedef std::map<std::pair<stk::mesh::EntityRank, stk::mesh::Selector>, stk::mesh::BucketVector> BucketCache;
+  mutable BucketCache bucketCache_;
+  mutable size_t bucketCacheSyncCount_;
   Teuchos::RCP<stk::mesh::Selector> activePartForIO_;
+  std::vector<Teuchos::RCP<stk::mesh::Selector> > outputRegionSelectors_;
+  size_t insituFileIndex_;
   AlgorithmDriver *postConvergedAlgDriver_;
   std::vector<Algorithm *> postConvergedAlg_;
 
@@ -395,8 +562,16 @@ class Realm {
 
   double maxCourant_;
   double maxReynolds_;
+  // local maxima accumulated by the momentum assembly; see fuse_courant_reynolds
+  double assembledMaxCourant_;
+  double assembledMaxReynolds_;
   double targetCourant_;
   double timeStepChangeFactor_;
+  // PI step-size control on a temporal error estimate; target_courant bounds it
+  bool piTimeStepControl_;
+  double temporalErrorTolerance_;
+  double temporalErrorN_;
+  double previousTimeStep_;
   int currentNonlinearIteration_;
 
   SolutionOptions *solutionOptions_;
@@ -405,6 +580,18 @@ class Realm {
   SolutionNormPostProcessing *solutionNormPostProcessing_;
   TurbulenceAveragingPostProcessing *turbulenceAveragingPostProcessing_;
   DataProbePostProcessing *dataProbePostProcessing_;
+  PlaneAveragingPostProcessing *planeAveragingPostProcessing_;
+  MeshRebalance *meshRebalance_;
+  FaceGeometryCache *faceGeometryCache_;
+  MemoryCheckpoint *memoryCheckpoint_;
+  ScratchArena *scratchArena_;
+  AlgorithmTimers *algorithmTimers_;
+  CommProfiler *commProfiler_;
+  TpetraGraphRegistry *tpetraGraphRegistry_;
+  ElemColoring *edgeColoring_;
+  ElemColoring *elemColoring_;
+  // independent property algorithms on threads; see use_property_task_graph
+  TaskGraph *propertyTaskGraph_;
 
   std::vector<Algorithm *> propertyAlg_;
   std::map<PropertyIdentifier, ScalarFieldType *> propertyMap_;
@@ -426,6 +613,9 @@ class Realm {
   double timerTransferSearch_;
   double timerTransferExecute_;
   double timerSkinMesh_;
+  // all advance_time_step work; with the owned node counts, shows how the
+  // realms of a coupled run share the ranks
+  double timerAdvance_;
 
   ContactManager *contactManager_;
   NonConformalManager *nonConformalManager_;
@@ -443,6 +633,35 @@ class Realm {
   bool hasPeriodic_;
   bool hasFluids_;
 
+  // rotation of each moving block: of its current coordinates and of the
+  // angle for which its area vectors were last computed
+  std::map<stk::mesh::Part *, double> meshMotionAngle_;
+  std::map<stk::mesh::Part *, double> geometryAngle_;
+
+  // fields queued by nodal_field_update while a batch is open
+  int nodalFieldUpdateBatchDepth_;
+  std::vector<stk::mesh::FieldBase *> batchFieldVec_;
+  std::vector<unsigned> batchSizeVec_;
+
+  // split-phase shared node sums of overlapped nodal_field_update calls
+  bool overlapNodalFieldUpdates_;
+  SharedNodeFieldSum *sharedNodeFieldSum_;
+
+  // one global reduction for the post processing of a step
+  PostProcessingReduction *postProcessingReduction_;
+
+  // modification epochs of tracked fields and of their last exchange, keyed
+  // by ghosting ordinal; skipped field exchanges are counted for the timers
+  uint64_t fieldEpoch_;
+  uint64_t allFieldsModifiedEpoch_;
+  std::map<const stk::mesh::FieldBase *, uint64_t> fieldModifiedEpoch_;
+  std::map<std::pair<unsigned, const stk::mesh::FieldBase *>, uint64_t> fieldSyncEpoch_;
+  std::vector<const stk::mesh::FieldBase *> ghostFieldScratchVec_;
+  std::vector<const stk::mesh::FieldBase *> ghostNodeFieldScratchVec_;
+  // node send plans of compact_ghost_exchange, keyed by ghosting ordinal
+  std::map<unsigned, GhostedNodeFieldExchange *> ghostedNodeFieldExchange_;
+  uint64_t numFieldSyncsSkipped_;
+
   // global parameter list
   stk::util::ParameterList globalParameters_;
 
@@ -452,6 +671,9 @@ class Realm {
   // part for new edges
   stk::mesh::Part *edgesPart_;
 
+  // global ids of the edges of each element, by edge ordinal; restart only
+  GenericFieldType *edgeConnectivity_;
+
   bool checkForMissingBcs_;
 
   // types of physics
@@ -461,17 +683,36 @@ class Realm {
   // some post processing of entity counts
   bool provideEntityCount_;
 
+  // json lines copy of the timer overview, <name>.timing_summary.json
+  bool writeTimingSummary_;
+
   // pointer to HDF5 file structure holding table
   HDF5FilePtr *HDF5ptr_;
 
-  // automatic mesh decomposition; None, rib, rcb, multikl, etc.
+  // automatic mesh decomposition; None, rib, rcb, kway, etc. The mesh is
+  // read once and partitioned in memory at startup
   std::string autoDecompType_;
 
+  // node ordering of the linear system rows; natural, morton or rcm
+  std::string nodeOrdering_;
+
+  // diagnostic fields stored in single precision; never output or restarted
+  std::set<std::string> singlePrecisionFields_;
+  bool single_precision_field(const std::string &fieldName) const;
+
   // allow aura to be optional
   bool activateAura_;
 
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
+  std::vector<std::pair<std::string, size_t> > memoryPhases_;
+
+  // per-phase startup report; wall time of each phase and high-water mark at its end
+  bool reportStartupPhases_;
+  double startupPhaseStart_;
+  std::vector<std::string> startupPhaseNames_;
+  std::vector<double> startupPhaseWall_;
+  std::vector<double> startupPhaseHwm_;
 
   // sometimes restarts can be missing states or dofs
   bool supportInconsistentRestart_;
@@ -496,6 +737,12 @@ class Realm {
   void process_initialization_transfer();
   void process_io_transfer();
 
+  // multi physics transfers into this realm are posted by the sending realm
+  // and executed once, just before this realm next reads them
+  std::vector<Transfer *> pendingTransferVec_;
+  void post_transfer(Transfer *transfer);
+  void complete_pending_transfers();
+
   // process end of time step converged work
   void post_converged_work();
 
@@ -507,6 +754,13 @@ class Realm {
   double get_gamma3();
   int get_time_step_count() const;
 
+  // a realm solved every solveFrequency_ steps takes one step over the
+  // time since its last solve; states only rotate on the steps it solves.
+  // Until its first solve the global step and gammas are returned
+  bool advances_this_step();
+  void begin_subcycling();
+  void update_subcycle_time_step();
+
   // restart
   bool restarted_simulation();
   bool support_inconsistent_restart();
@@ -517,6 +771,17 @@ class Realm {
   bool process_adaptivity();
 };
 
+// the realm communicator is the parallel one (NaluEnv::parallel_comm) for
+// the lifetime of the scope; only on the ranks of the realm
+class RealmCommScope
+{
+public:
+  RealmCommScope(const Realm &realm);
+  ~RealmCommScope();
+private:
+  const bool pushed_;
+};
+
 } // namespace nalu
 } // namespace Sierra
 
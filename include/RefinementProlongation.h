@@ -0,0 +1,43 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef RefinementProlongation_h
+#define RefinementProlongation_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// a node of one refinement level as a combination of the nodes of the next
+// coarser level; the nodes both levels have in common map to themselves
+typedef std::vector<std::pair<stk::mesh::Entity, double> > NodeInterpolation;
+typedef std::map<stk::mesh::Entity, NodeInterpolation> LevelProlongation;
+
+// interpolation between the levels of the uniform refinement hierarchy
+// kept by percept, finest (active elements) first; every locally present
+// node of a level's elements is covered. A level exists only when all
+// elements of the finer level have a parent. The weights are the shape
+// functions of the parent element at the child node, so topologies without
+// isInElement (pyramids) are not supported. The number of levels; none
+// without percept or before the first refinement
+int refinement_prolongations(
+  Realm &realm,
+  const int maxLevels,
+  std::vector<LevelProlongation> &levels);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -57,6 +57,10 @@ public:
   VectorFieldType *Gjq_;
   VectorFieldType *Gjp_;
   VectorFieldType *coordinates_;
+  GenericFieldType *scsAreav_;
+  GenericFieldType *scsDndx_;
+  GenericFieldType *scsGUpper_;
+  GenericFieldType *scsGLower_;
  
   const int nDim_;
   const double Cupw_;
@@ -36,6 +36,13 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual void node_bucket_execute(
+    double *lhs,
+    double *rhs,
+    const int lhsSize,
+    const int rhsSize,
+    const stk::mesh::Bucket &b);
+
   ScalarFieldType *scalarQNm1_;
   ScalarFieldType *scalarQN_;
   ScalarFieldType *scalarQNp1_;
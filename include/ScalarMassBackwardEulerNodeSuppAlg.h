@@ -41,6 +41,7 @@ public:
   ScalarFieldType *densityN_;
   ScalarFieldType *densityNp1_;
   ScalarFieldType *dualNodalVolume_;
+  ScalarFieldType *localTimeStep_;
   double dt_;					
 };
 
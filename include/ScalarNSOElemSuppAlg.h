@@ -60,6 +60,10 @@ public:
   VectorFieldType *velocityRTM_;
   VectorFieldType *Gjq_;
   VectorFieldType *coordinates_;
+  GenericFieldType *scsAreav_;
+  GenericFieldType *scsDndx_;
+  GenericFieldType *scsGUpper_;
+  GenericFieldType *scsGLower_;
 
   double dt_;
   const int nDim_;
@@ -0,0 +1,62 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ScratchArena_h
+#define ScratchArena_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_topology/topology.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+// named work arrays, keyed by topology, that persist across algorithms and
+// time steps; storage is allocated the first time a topology is seen and the
+// same memory is handed back on every later request. Arrays are shared by
+// name, so a caller must be done with its arrays before another algorithm
+// executes (the usual serial algorithm sequence)
+class ScratchArena
+{
+public:
+
+  ScratchArena();
+  ~ScratchArena();
+
+  std::vector<double> &get_double(
+    const stk::topology &theTopo,
+    const std::string &name,
+    const size_t size);
+
+  std::vector<int> &get_int(
+    const stk::topology &theTopo,
+    const std::string &name,
+    const size_t size);
+
+  std::vector<stk::mesh::Entity> &get_entity(
+    const stk::topology &theTopo,
+    const std::string &name,
+    const size_t size);
+
+private:
+
+  typedef std::pair<stk::topology, std::string> ScratchKey;
+
+  std::map<ScratchKey, std::vector<double> > doubleScratch_;
+  std::map<ScratchKey, std::vector<int> > intScratch_;
+  std::map<ScratchKey, std::vector<stk::mesh::Entity> > entityScratch_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,97 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef SharedNodeFieldSum_h
+#define SharedNodeFieldSum_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+class FieldBase;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// SharedNodeFieldSum
+//=============================================================================
+/**
+ * * @par Description:
+ * - split-phase equivalent of stk::mesh::parallel_sum over the shared nodes:
+ *   start() packs the local contributions and posts non-blocking messages,
+ *   finish() waits and adds the neighbour contributions.
+ *
+ * @par Design Considerations:
+ * - the nodes shared with each neighbour are listed once, sorted by id so
+ *   that both sides pack in the same order; the lists are rebuilt when the
+ *   bulk data has been modified since.  Several fields may be in flight; a
+ *   field must neither be read on shared nodes nor written until finish().
+ */
+//=============================================================================
+class SharedNodeFieldSum {
+
+ public:
+
+  SharedNodeFieldSum(stk::mesh::BulkData &bulkData);
+  ~SharedNodeFieldSum();
+
+  // post the exchange of sizeOfField doubles per shared node
+  void start(
+    stk::mesh::FieldBase *theField,
+    const unsigned sizeOfField);
+
+  // complete all exchanges started; no-op when none are in flight
+  void finish();
+
+  bool in_flight() const { return !pending_.empty(); }
+
+ private:
+
+  void build_comm_lists();
+
+  struct PendingSum {
+    stk::mesh::FieldBase *field_;
+    unsigned sizeOfField_;
+    std::vector<double> sendBuffer_;
+    std::vector<double> recvBuffer_;
+  };
+
+  stk::mesh::BulkData &bulkData_;
+  MPI_Comm comm_;
+  size_t syncCount_;
+  bool commListsBuilt_;
+
+  // neighbour procs and their shared nodes, flattened with offsets
+  std::vector<int> neighborProcs_;
+  std::vector<size_t> nodeOffset_;
+  std::vector<stk::mesh::Entity> sharedNodes_;
+
+  // heap allocated so the buffers never move while in flight
+  std::vector<PendingSum *> pending_;
+  std::vector<MPI_Request> requests_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
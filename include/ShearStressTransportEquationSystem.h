@@ -35,6 +35,8 @@ public:
   ShearStressTransportEquationSystem(
     EquationSystems& equationSystems);
   virtual ~ShearStressTransportEquationSystem();
+
+  virtual void load(const YAML::Node & node);
   
   virtual void initialize();
 
@@ -54,9 +56,11 @@ public:
   void initial_work();
   void post_adapt_work();
 
+  void compute_min_distance_to_wall();
   void clip_min_distance_to_wall();
   void compute_f_one_blending();
   void update_and_clip();
+  void update_tke_for_coupling();
 
   TurbKineticEnergyEquationSystem *tkeEqSys_;
   SpecificDissipationRateEquationSystem *sdrEqSys_;
@@ -68,10 +72,20 @@ public:
   ScalarFieldType *maxLengthScale_;
 
   bool isInit_;
+
+  // solve sdr against the freshly updated tke rather than the lagged one
+  bool gaussSeidelCoupling_;
+
+  // minimum_distance_to_wall computed by WallDistanceCalculator at startup
+  bool computeWallDistance_;
   AlgorithmDriver *sstMaxLengthScaleAlgDriver_;
+  int maxLengthScaleStep_; // time step of the last max length scale evaluation
 
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part *> wallBcPart_;
+
+  // parts holding minimum_distance_to_wall
+  std::vector<stk::mesh::Part *> minDistanceToWallPart_;
      
 };
 
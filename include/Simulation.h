@@ -24,6 +24,7 @@ class TimeIntegrator;
 class Realms;
 class Transfers;
 class UnitTests;
+class AssemblyBenchmark;
 
 class Simulation {
 public:
@@ -52,10 +53,13 @@ public:
   LinearSolvers *linearSolvers_;
 
   UnitTests *unitTests_;
+  AssemblyBenchmark *assemblyBenchmark_;
 
   static bool debug_;
   bool runOnlyUnitTests_;
   int serializedIOGroupSize_;
+  // the group size came from the command line rather than an input file
+  bool serializedIOFromCommandLine_;
 };
 
 } // namespace nalu
@@ -10,7 +10,9 @@
 #define SolutionNormPostProcessing_h
 
 #include <NaluParsing.h>
+#include <PostProcessingReduction.h>
 
+#include <map>
 #include <string>
 #include <vector>
 #include <utility>
@@ -18,6 +20,7 @@
 // stk forwards
 namespace stk {
   namespace mesh {
+    class Bucket;
     class BulkData;
     class FieldBase;
     class MetaData;
@@ -29,10 +32,10 @@ namespace stk {
 namespace sierra{
 namespace nalu{
 
-class AuxFunctionAlgorithm;
+class AuxFunction;
 class Realm;
 
-class SolutionNormPostProcessing
+class SolutionNormPostProcessing : public PostProcessingReductionClient
 {
 public:
   
@@ -44,19 +47,20 @@ public:
   void load(
     const YAML::Node & node);
 
-  // setup nodal field registration; algorithms
+  // setup parts and analytical functions
   void setup(
     const std::vector<std::string> targetNames);
 
-  // create the algorithm to populate the exact field
-  void analytical_function_factory(
-    const std::string functionName,
-    stk::mesh::FieldBase *exactDofField,
-    stk::mesh::Part *part);
+  // create the analytical function for a dof
+  AuxFunction *analytical_function_factory(
+    const std::string functionName);
 
-  // populate nodal field and output norms (if appropriate)
+  // output norms (if appropriate)
   void execute();
 
+  // output the norms once the step's post processing reduction is complete
+  void write_reduced(const PostProcessingReduction &reduction);
+
   // hold the realm
   Realm &realm_;
 
@@ -81,14 +85,25 @@ public:
   // hold the dofName, functionName in a vector 
   std::vector<std::pair<std::string, std::string> > dofFunctionVec_;
 
-  // hold the dofField and exactDofField
-  std::vector<std::pair<const stk::mesh::FieldBase*, stk::mesh::FieldBase*> > fieldPairVec_;
+  // hold the dofField and its analytical function
+  std::vector<const stk::mesh::FieldBase*> dofFieldVec_;
+  std::vector<AuxFunction *> exactFunctionVec_;
 
   // vector of parts for post processing
   stk::mesh::PartVector partVec_;
 
-  // vector of algorithms that process the analytical field
-  std::vector<AuxFunctionAlgorithm *> populateExactNodalFieldAlg_;
+  // analytical values evaluated straight into the norm loop; per bucket
+  // copies of the time independent ones are kept until the mesh changes
+  std::vector<std::map<const stk::mesh::Bucket *, std::vector<double> > > exactCache_;
+  size_t exactCacheSyncCount_;
+  std::vector<double> ws_exact_;
+
+  // contributions to the pending reduction and the step they belong to
+  size_t nodeCountHandle_;
+  size_t looNormHandle_;
+  size_t l12NormHandle_;
+  int outputTimeStepCount_;
+  double outputTime_;
 };
 
 } // namespace nalu
@@ -31,6 +31,24 @@ enum ErrorIndicatorType {
 };
 
 
+// per-dof numerics resolved from the option maps and defaults; assembly
+// algorithms hold a handle rather than searching the maps every execute
+struct DofNumerics
+{
+  DofNumerics()
+    : hybrid_(0.0), alpha_(0.0), alphaUpw_(1.0), upw_(1.0),
+      useLimiter_(false), noc_(true), nso_(false), nsoFourthFac_(0.0) {}
+  double hybrid_;
+  double alpha_;
+  double alphaUpw_;
+  double upw_;
+  bool useLimiter_;
+  bool noc_;
+  // edge-based NSO, activated by an NSO_* entry in the element source terms
+  bool nso_;
+  double nsoFourthFac_;
+};
+
 class SolutionOptions
 {
 public:
@@ -40,6 +58,14 @@ public:
 
   void load(const YAML::Node & node);
   void initialize_turbulence_constants();
+
+  // handle to the numerics of a dof; resolved on first request and valid for
+  // the lifetime of the options
+  const DofNumerics &dof_numerics(const std::string &dofName);
+
+  // re-resolve all handed out numerics after the option maps change
+  void update_dof_numerics();
+
   double hybridDefault_;
   double alphaDefault_;
   double alphaUpwDefault_;
@@ -51,6 +77,7 @@ public:
   std::string pecletFunctionalFormDefault_;
   double pecletTanhTransDefault_;
   double pecletTanhWidthDefault_;
+  int pecletTanhTableSizeDefault_;
   double referenceDensity_;
   double referenceTemperature_;
   double thermalExpansionCoeff_;
@@ -63,11 +90,13 @@ public:
   bool meshMotion_;
   bool meshDeformation_;
   bool externalMeshDeformation_;
+  bool rigidBodyMeshMotion_;
   bool activateUniformRefinement_;
   bool uniformRefineSaveAfter_;
   std::vector<int> refineAt_;
   bool activateAdaptivity_;
   ErrorIndicatorType errorIndicatorType_;
+  bool errorIndicatorInAssembly_;
   int adaptivityFrequency_;
   bool useMarker_;
   double refineFraction_;
@@ -87,9 +116,28 @@ public:
   bool cvfemShiftMdot_;
   bool cvfemShiftPoisson_;
   bool cvfemReducedSensPoisson_;
+  bool cvfemShiftElemAssembly_;
   double inputVariablesRestorationTime_;
   bool consistentMMPngDefault_;
   bool useConsolidatedSolverAlg_;
+  bool useThreadedAssembly_;
+  std::string threadBinding_;
+  bool numaPagePlacement_;
+  std::string hugePages_;
+  bool useDeviceEdgeAssembly_;
+  bool useDevicePropertyEvaluation_;
+  bool cacheElemGeometry_;
+  bool compactGhostExchange_;
+  bool algorithmTimerTrace_;
+  bool fuseEffectiveViscosity_;
+  bool fuseMdotUpdate_;
+  bool fuseCourantReynolds_;
+  bool localTimeStepping_;
+  double localTimeStepCourant_;
+  bool usePropertyTaskGraph_;
+  bool extrapolatePredictor_;
+  bool approximateProjection_;
+  bool shareSpeciesOperator_;
 
   // turbulence model coeffs
   std::map<TurbulenceModelConstant, double> turbModelConstantMap_;
@@ -103,8 +151,12 @@ public:
   std::map<std::string, std::string> pecletFunctionalFormMap_;
   std::map<std::string, double> pecletFunctionTanhTransMap_;
   std::map<std::string, double> pecletFunctionTanhWidthMap_;
+  std::map<std::string, int> pecletFunctionTanhTableSizeMap_;
   std::map<std::string, bool> consistentMassMatrixPngMap_;
 
+  // resolved numerics by dof name
+  std::map<std::string, DofNumerics> dofNumericsMap_;
+
   // property related
   std::map<std::string, double> lamScMap_;
   std::map<std::string, double> lamPrMap_;
@@ -133,6 +185,21 @@ public:
 
   std::string name_;
 
+private:
+
+  void resolve_dof_numerics(
+    const std::string &dofName,
+    DofNumerics &numerics) const;
+
+  template<typename T>
+  static T find_or_default(
+    const std::map<std::string, T> &theMap,
+    const std::string &dofName,
+    const T defaultValue)
+  {
+    typename std::map<std::string, T>::const_iterator iter = theMap.find(dofName);
+    return iter != theMap.end() ? iter->second : defaultValue;
+  }
 };
 
 } // namespace nalu
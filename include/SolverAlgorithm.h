@@ -10,6 +10,7 @@
 #define SolverAlgorithm_h
 
 #include <Algorithm.h>
+#include <ExecutionPlan.h>
 
 #include <stk_mesh/base/Entity.hpp>
 #include <vector>
@@ -43,8 +44,21 @@ protected:
     const std::vector<double> &rhs,
     const std::vector<double> &lhs,
     const char *trace_tag=0);
+
+  // interior element algorithms; the element keys the cached matrix offsets
+  void apply_coeff(
+    const stk::mesh::Entity elem,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> &rhs,
+    const std::vector<double> &lhs,
+    const char *trace_tag=0);
   
   EquationSystem *eqSystem_;
+
+  // element buckets by topology; rebuilt after mesh modification
+  ExecutionPlan elemPlan_;
 };
 
 } // namespace nalu
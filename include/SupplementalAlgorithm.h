@@ -15,10 +15,17 @@
 #include <stk_mesh/base/Types.hpp>
 #include <stk_mesh/base/Entity.hpp>
 
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
 class Realm;
+class SuppAlgElemData;
 
 class SupplementalAlgorithm
 {
@@ -42,12 +49,27 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node) {}
+
+  // node_execute over a whole bucket; lhs/rhs hold b.size() consecutive
+  // blocks of lhsSize/rhsSize entries. The default calls node_execute
+  virtual void node_bucket_execute(
+    double *lhs,
+    double *rhs,
+    const int lhsSize,
+    const int rhsSize,
+    const stk::mesh::Bucket &b);
   
   virtual void elem_resize(
     MasterElement *meSCS,
     MasterElement *meSCV) {}
 
+  // SuppAlgElemDataRequest bits of the element data taken from the host
+  virtual unsigned elem_data_requests() const { return 0; }
+
   Realm &realm_;  
+
+  // set by a host that provides the requested data; NULL otherwise
+  SuppAlgElemData *elemData_;
 };
 
 } // namespace nalu
@@ -0,0 +1,88 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef SupplementalAlgorithmElemData_h
+#define SupplementalAlgorithmElemData_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class MasterElement;
+class Realm;
+class SupplementalAlgorithm;
+
+// element data a supplemental algorithm may take from its host rather than
+// gather and evaluate itself
+enum SuppAlgElemDataRequest {
+  SUPP_ELEM_DATA_COORDINATES = 1 << 0,
+  SUPP_ELEM_DATA_SCV_VOLUME  = 1 << 1,
+  SUPP_ELEM_DATA_SCS_AREAV   = 1 << 2,
+  SUPP_ELEM_DATA_SCS_GRAD_OP = 1 << 3, // dndx, deriv and det_j of grad_op
+  SUPP_ELEM_DATA_SCS_GIJ     = 1 << 4  // metric tensor g^ij and g_ij at the scs ips
+};
+
+// one gather of the coordinates and one set of master element evaluations
+// per element, shared by every supplemental algorithm of a host algorithm
+class SuppAlgElemData
+{
+public:
+
+  SuppAlgElemData(
+    Realm &realm);
+  ~SuppAlgElemData();
+
+  // union over the algorithms; attaches this object to those that requested
+  void attach(
+    std::vector<SupplementalAlgorithm *> &supplementalAlg);
+
+  bool active() const { return 0 != requests_; }
+
+  void resize(
+    MasterElement *meSCS,
+    MasterElement *meSCV);
+
+  void compute(
+    stk::mesh::Entity element,
+    MasterElement *meSCS,
+    MasterElement *meSCV);
+
+  std::vector<double> coordinates_;
+  std::vector<double> scvVolume_;
+  std::vector<double> scsAreav_;
+  std::vector<double> scsDndx_;
+  std::vector<double> scsDeriv_;
+  std::vector<double> scsDetJ_;
+  std::vector<double> scsGUpper_;
+  std::vector<double> scsGLower_;
+
+private:
+
+  stk::mesh::BulkData &bulkData_;
+  VectorFieldType *coordinatesField_;
+  GenericFieldType *scsGUpperField_;
+  GenericFieldType *scsGLowerField_;
+  const int nDim_;
+  unsigned requests_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -11,6 +11,7 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<PostProcessingReduction.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -20,7 +21,7 @@ namespace nalu{
 
 class Realm;
 
-class SurfaceForceAndMomentWallFunctionAlgorithm : public Algorithm
+class SurfaceForceAndMomentWallFunctionAlgorithm : public Algorithm, public PostProcessingReductionClient
 {
 public:
 
@@ -37,6 +38,9 @@ public:
 
   void pre_work();
 
+  // output once the step's post processing reduction is complete
+  void write_reduced(const PostProcessingReduction &reduction);
+
   void cross_product(
     double *force, double *cross, double *rad);
 
@@ -63,6 +67,12 @@ public:
   ScalarFieldType *assembledArea_;
 
   const int w_;
+
+  // contributions to the pending reduction and the time they belong to
+  size_t forceMomentHandle_;
+  size_t yplusMinHandle_;
+  size_t yplusMaxHandle_;
+  double outputTime_;
 };
 
 } // namespace nalu
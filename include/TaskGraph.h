@@ -0,0 +1,58 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TaskGraph_h
+#define TaskGraph_h
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Algorithm;
+class Realm;
+
+// dependency levels of an ordered list of algorithms; an algorithm is placed
+// one level after the last earlier algorithm whose field read/write set
+// conflicts with its own, so the algorithms within a level are independent
+// and can execute concurrently while the sequential result is preserved
+class TaskGraph
+{
+public:
+
+  TaskGraph(
+    Realm &realm);
+  ~TaskGraph();
+
+  // rebuild the levels if the algorithm list has changed
+  void update(
+    const std::vector<Algorithm *> &algs);
+
+  // levels in order; threads over the algorithms of a level
+  void execute();
+
+  std::vector<std::vector<Algorithm *> > levels_;
+
+private:
+
+  void build(
+    const std::vector<Algorithm *> &algs);
+
+  Realm &realm_;
+  std::vector<Algorithm *> algs_;
+
+  // bucket lookups fill the stk selector cache on first use; a level runs
+  // serially after every mesh modification before it is threaded
+  size_t syncCount_;
+  bool warm_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,67 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ThreadPlacement_h
+#define ThreadPlacement_h
+
+#include <stk_mesh/base/Selector.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+// thread binding, a placement report and NUMA page placement for hybrid
+// (MPI plus OpenMP) runs; Linux only, no-ops elsewhere and without OpenMP.
+//
+// stk and Tpetra allocate (and initialize) their storage on the master
+// thread, so first touch puts every page on its NUMA domain. The pages are
+// instead moved, once they exist, to the domain of the thread that works on
+// them under the static schedule of the threaded loops
+
+// pin each OpenMP thread to one cpu of the set the rank was started on
+// (e.g., the socket of an mpirun --bind-to socket); "compact" takes
+// neighbouring cpus, "spread" strides over the set and "none" leaves the
+// placement to the OpenMP runtime (OMP_PROC_BIND, OMP_PLACES)
+void bind_threads(const std::string &policy);
+
+// collective; cpu and NUMA domain of every thread of every rank, on rank 0
+void report_thread_placement(std::ostream &out);
+
+// the part of [0, n) a schedule(static) loop hands to thread t of numThreads
+void static_thread_range(
+  const size_t n,
+  const int t,
+  const int numThreads,
+  size_t &begin,
+  size_t &end);
+
+// move the whole pages within [begin, begin+bytes) to the NUMA domain of the
+// calling thread; the number of pages that are there afterwards
+size_t place_pages(
+  void *begin,
+  const size_t bytes);
+
+// node rank field data of the selected buckets, split over the threads as
+// the owner-computes node loops split the nodes; the pages placed
+size_t place_node_field_pages(
+  stk::mesh::BulkData &bulkData,
+  const stk::mesh::Selector &selector);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -40,6 +40,9 @@ public:
 
   void integrate_realm();
   void provide_mean_norm();
+  void synchronize_restart_time();
+  // restores the memory checkpoint when the step produced a non-finite norm
+  bool rollback_diverged_step();
   bool simulation_proceeds();
   Simulation& sim_;
 
@@ -58,6 +61,15 @@ public:
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
 
+  // dt of the steps repeated after a rollback is scaled by the factor until
+  // the time of the diverged step is passed again; an adaptive dt is scaled
+  // once per rollback and then left to the controller
+  double rollbackTimeStepFactor_;
+  int maxRollbacks_;
+  int numRollbacks_;
+  double rollbackScale_;
+  double rollbackTime_;
+
   std::string name_;
 
   std::vector<std::string> realmNamesVec_;
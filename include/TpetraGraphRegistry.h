@@ -0,0 +1,88 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TpetraGraphRegistry_h
+#define TpetraGraphRegistry_h
+
+#include <LinearSolverTypes.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <boost/unordered_map.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+typedef boost::unordered_map<stk::mesh::EntityId, size_t>  MyLIDMapType;
+
+// finalized maps, graphs and local numbering of a TpetraLinearSystem; every
+// system whose graph requests match (same build calls on the same parts and
+// the same dof layout) assembles into matrices created on this one graph
+struct TpetraSharedGraph
+{
+  std::string ownerName_; // system that built the graph
+  Teuchos::RCP<LinSys::Map> totalColsMap_;
+  Teuchos::RCP<LinSys::Map> ownedRowsMap_;
+  Teuchos::RCP<LinSys::Map> ownedPlusGloballyOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Map> globallyOwnedRowsMap_;
+  Teuchos::RCP<LinSys::Graph> ownedGraph_;
+  Teuchos::RCP<LinSys::Graph> globallyOwnedGraph_;
+  Teuchos::RCP<LinSys::Export> exporter_;
+  Teuchos::RCP<LinSys::Import> importer_;
+  Teuchos::RCP<const LinSys::Map> ownedVectorMap_;
+  Teuchos::RCP<const LinSys::Map> globallyOwnedVectorMap_;
+  Teuchos::RCP<LinSys::Export> vectorExporter_;
+
+  MyLIDMapType myLIDs_;
+  std::vector<LinSys::LocalOrdinal> entityRowOffsets_;
+  LinSys::LocalOrdinal maxOwnedRowId_;
+  LinSys::LocalOrdinal maxGloballyOwnedRowId_;
+
+  // with mesh motion: connections of the fixed requests (owned elements,
+  // edges, faces and nodes; shared by the graphs of later steps) and the
+  // current interface coupling by nalu id, sorted
+  Teuchos::RCP<const std::vector<std::pair<stk::mesh::Entity, stk::mesh::Entity> > > fixedConnections_;
+  std::vector<std::pair<stk::mesh::EntityId, stk::mesh::EntityId> > interfaceConnectionIds_;
+};
+
+// realm-wide registry of finalized graphs; cleared whenever the linear
+// systems are re-initialized (adaptivity, mesh motion, overset)
+class TpetraGraphRegistry
+{
+public:
+
+  TpetraGraphRegistry();
+  ~TpetraGraphRegistry();
+
+  // Teuchos::null if no graph has been registered under the key
+  Teuchos::RCP<TpetraSharedGraph> find(
+    const std::string &key) const;
+
+  void insert(
+    const std::string &key,
+    Teuchos::RCP<TpetraSharedGraph> graph);
+
+  void clear();
+
+private:
+
+  std::map<std::string, Teuchos::RCP<TpetraSharedGraph> > graphs_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
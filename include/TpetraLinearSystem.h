@@ -10,6 +10,7 @@
 #define TpetraLinearSystem_h
 
 #include <LinearSystem.h>
+#include <TpetraGraphRegistry.h>
 
 #include <Tpetra_DefaultPlatform.hpp>
 #include <Kokkos_DefaultNode.hpp>
@@ -19,9 +20,12 @@
 
 #include <stk_mesh/base/Entity.hpp>
 
+#include <deque>
+#include <fstream>
+#include <map>
 #include <vector>
 #include <string>
-#include <boost/unordered_map.hpp>
+#include <utility>
 
 namespace stk {
 namespace mesh {
@@ -34,8 +38,9 @@ namespace nalu{
 
 class Realm;
 class LinearSolver;
-
-typedef boost::unordered_map<stk::mesh::EntityId, size_t>  MyLIDMapType;
+class MatrixFreeOperator;
+class TpetraLinearSolver;
+class TpetraLinearSolverConfig;
 
 class TpetraLinearSystem : public LinearSystem
 {
@@ -61,6 +66,9 @@ public:
   void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts); // nonConformal->node assembly
   void buildOversetNodeGraph(const stk::mesh::PartVector & parts); // overset->elem_node assembly
   void finalizeLinearSystem();
+  bool updateInterfaceGraph();
+  size_t placePages();
+  size_t adviseHugePages();
 
   // Matrix Assembly
   void zeroSystem();
@@ -74,6 +82,32 @@ public:
     const char *trace_tag=0
     );
 
+  void sumIntoElem(
+    const stk::mesh::Entity elem,
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void sumIntoRows(
+    const std::vector<stk::mesh::Entity> & entities,
+    const size_t numRowObj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  bool deviceRowOffsets(
+    const std::vector<stk::mesh::Entity> &nodes,
+    std::vector<int> &rowOffsets);
+  bool beginDeviceAssembly(DeviceEdgeSystem &deviceSystem);
+  void endDeviceAssembly();
+
   void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -81,6 +115,14 @@ public:
     const unsigned beginPos,
     const unsigned endPos);
 
+  void applyCoupledDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned dofOffset);
+
   void prepareConstraints(
     const unsigned beginPos,
     const unsigned endPos);
@@ -91,7 +133,13 @@ public:
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
+  void memoryUsage(
+    size_t &graphBytes,
+    size_t &matrixBytes,
+    size_t &vectorBytes,
+    size_t &preconditionerBytes) const;
   size_t lookup_myLID(MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const std::string& msg="", stk::mesh::Entity entity = stk::mesh::Entity());
+  LocalOrdinal lookup_row_offset(stk::mesh::Entity entity, const char *msg="");
 
   enum DOFStatus {
     DS_NotSet           = 0,
@@ -106,6 +154,44 @@ public:
 private:
   void beginLinearSystemConstruction();
 
+  // build*Graph() calls are recorded and replayed in finalizeLinearSystem()
+  // only when no matching graph has been registered by another system
+  enum GraphRequestType {
+    GRAPH_NODE = 0,
+    GRAPH_FACE,
+    GRAPH_EDGE,
+    GRAPH_ELEM,
+    GRAPH_REDUCED_ELEM,
+    GRAPH_FACE_ELEM,
+    GRAPH_EDGE_HALO,
+    GRAPH_NON_CONFORMAL,
+    GRAPH_OVERSET
+  };
+
+  // true when recorded; false when replaying and the connections are to be added
+  bool addGraphRequest(
+    const GraphRequestType type,
+    const stk::mesh::PartVector & parts);
+
+  // contact halo, non-conformal and overset couplings move with the mesh;
+  // all other requests give fixed connections
+  static bool isInterfaceRequest(const GraphRequestType type);
+  void replayGraphRequests(const bool interfaceRequests);
+  void interfaceConnectionIds(
+    std::vector<std::pair<stk::mesh::EntityId, stk::mesh::EntityId> > & connectionIds);
+
+  std::string graphKey() const;
+  void buildGraph();
+  void adoptSharedGraph(const TpetraSharedGraph & sharedGraph);
+  Teuchos::RCP<TpetraSharedGraph> createSharedGraph() const;
+
+  // graph of the moved mesh; the current one when neither the rows nor the
+  // interface coupling changed
+  Teuchos::RCP<TpetraSharedGraph> updateSharedGraph();
+
+  // matrices, vectors and solver setup on the adopted graph
+  void createSystemObjects();
+
   void checkError(
     const int err_code,
     const char * msg) {}
@@ -119,18 +205,121 @@ private:
   void copy_stk_to_tpetra(stk::mesh::FieldBase * stkField,
     const Teuchos::RCP<LinSys::MultiVector> tpetraVector);
 
+  void sumIntoBlock(
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs);
+
+  void zeroBlockRow(
+    const LocalOrdinal localId,
+    const double diagonalValue);
+
+  void sumIntoShared(
+    const std::vector<stk::mesh::Entity> & entities,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs);
+
+  // point vector (numDof_ per node) to one column per dof, and back
+  void toComponents(const LinSys::Vector & point, LinSys::MultiVector & components) const;
+  void fromComponents(const LinSys::MultiVector & components, LinSys::Vector & point) const;
+
+  // rows of one Dirichlet condition; found at the first application and kept
+  // with the graph. The replacement rows (zero but for the diagonal) are flat
+  struct DirichletRows {
+    std::vector<stk::mesh::Entity> nodes_;
+    std::vector<unsigned> dofs_; // field components
+    std::vector<LocalOrdinal> rows_;
+    std::vector<size_t> rowBegin_; // into indices_ and values_; size rows_ + 1
+    std::vector<LocalOrdinal> indices_;
+    std::vector<double> values_;
+  };
+
+  // componentCall: the field holds the dofs of a CoupledComponentLinearSystem
+  // from dofOffset on, not the whole row
+  void applyDirichletRows(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned dofOffset,
+    const bool componentCall);
+
+  DirichletRows & dirichletRows(
+    stk::mesh::FieldBase * solutionField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned dofOffset,
+    const bool componentCall);
+
+  typedef std::deque<Teuchos::RCP<LinSys::Vector> > SolutionHistory;
+
+  // sln_ from the previous increments; polynomial extrapolation or the
+  // minimum residual combination over the span of the history
+  void applyInitialGuess(const SolutionHistory & history);
+  void storeSolution(SolutionHistory & history);
+
+  // Eisenstat-Walker linear tolerance from the rhs norm of successive solves
+  double forcingTerm(
+    const TpetraLinearSolverConfig & config,
+    const double residual);
+
   void addConnections(const std::vector<stk::mesh::Entity> & entities);
   void checkForNaN(bool useOwned);
   bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
 
   typedef std::pair<stk::mesh::Entity, stk::mesh::Entity> Connection;
-  typedef std::set< Connection > ConnectionSet;
   typedef std::vector< Connection > ConnectionVec;
-  ConnectionSet connectionSet_;
+
+  // sort and remove duplicates; chunks are sorted concurrently with OpenMP
+  static void sortUniqueConnections(ConnectionVec & connections);
+
+  // flat (entity_min, entity_max) list; compacted whenever it doubles in size
+  ConnectionVec connectionVec_;
+  size_t connectionCompactSize_;
+  std::vector<std::pair<GraphRequestType, stk::mesh::PartVector> > graphRequests_; // kept for updateInterfaceGraph()
+  bool replayingGraphRequests_;
+  Teuchos::RCP<TpetraSharedGraph> sharedGraph_; // built or adopted in finalizeLinearSystem()
   std::vector<GlobalOrdinal> totalGids_;
 
   Teuchos::RCP<LinSys::Node>   node_;
 
+  // BlockCrsMatrix storage (one numDof_ x numDof_ block per node pair); the
+  // graph and row maps are then node-level, graphDof_ = 1, while vectors use the
+  // point maps below. Otherwise graphDof_ = numDof_ and the point maps are the row maps
+  bool useBlockMatrix_;
+  unsigned graphDof_;
+
+  // one scalar matrix on the node-level graph (graphDof_ = 1) for all
+  // components, the mean of the numDof_ diagonal blocks; vectors use the point
+  // maps and are solved as a numDof_ column multivector. Cross-component
+  // coupling is left to the rhs (the increment converges to the same solution)
+  bool sharedComponentMatrix_;
+  Teuchos::RCP<LinSys::MultiVector> componentRhs_;
+  Teuchos::RCP<LinSys::MultiVector> componentSln_;
+
+  // element matrices are kept in matrixFreeOperator_, which Belos applies;
+  // the matrices hold the reduced element graph for the preconditioner
+  bool matrixFree_;
+  Teuchos::RCP<MatrixFreeOperator> matrixFreeOperator_;
+
+  // globallyOwnedMatrix_ is never fill completed; it is only the source of
+  // the shared row export, which does not need a fill complete matrix
+  bool persistentFill_;
+
+  // sumIntoElem writes into the local matrix values; per element (local_offset)
+  // its row ids, then the numRows*numRows value offsets in the matrix owning
+  // the row, -1 outside the graph. Cleared with the matrices
+  bool cacheValueOffsets_;
+  std::vector<std::vector<LocalOrdinal> > elemValueOffsets_;
+  LinSys::Matrix::local_matrix_type ownedLocal_;
+  LinSys::Matrix::local_matrix_type globallyOwnedLocal_;
+  void computeElemValueOffsets(
+    const size_t numRows,
+    const std::vector<int> &rowIds,
+    std::vector<LocalOrdinal> &cached);
+
   // all rows, otherwise known as col map
   Teuchos::RCP<LinSys::Map>    totalColsMap_;
 
@@ -152,14 +341,70 @@ private:
   Teuchos::RCP<LinSys::Matrix> globallyOwnedMatrix_;
   Teuchos::RCP<LinSys::Vector> globallyOwnedRhs_;
 
+  Teuchos::RCP<LinSys::BlockMatrix> ownedBlockMatrix_;
+  Teuchos::RCP<LinSys::BlockMatrix> globallyOwnedBlockMatrix_;
+
   Teuchos::RCP<LinSys::Vector> sln_;
   Teuchos::RCP<LinSys::Vector> globalSln_;
   Teuchos::RCP<LinSys::Export> exporter_;
   Teuchos::RCP<LinSys::Import> importer_;
 
+  // point (dof-level) maps for the rhs and solution
+  Teuchos::RCP<const LinSys::Map> ownedVectorMap_;
+  Teuchos::RCP<const LinSys::Map> globallyOwnedVectorMap_;
+  Teuchos::RCP<LinSys::Export> vectorExporter_;
+
   MyLIDMapType myLIDs_;
+  std::vector<LocalOrdinal> entityRowOffsets_; // localId * numDof_, indexed by entity local_offset; -1 when not cached
+  std::vector<std::vector<std::pair<LocalOrdinal, int> > > sortedIds_; // per-thread sumInto column sort scratch
+  std::vector<std::vector<LocalOrdinal> > blockIds_; // per-thread block sumInto scratch
+  std::vector<std::vector<double> > blockVals_;
   LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
   LocalOrdinal maxGloballyOwnedRowId_; // = (num_owned_nodes + num_globallyOwned_nodes) * numDof_
+
+  // increments of previous time steps, newest first; keyed by nonlinear iteration
+  // and solve count within the iteration (e.g., the continuity projection)
+  std::map<std::pair<int, int>, SolutionHistory> slnHistory_;
+
+  // keyed by solution field, dof range and parts
+  std::map<std::string, DirichletRows> dirichletRows_;
+  std::vector<Teuchos::RCP<LinSys::Vector> > guessScratch_;
+  int lastSolveStep_;
+  int lastSolveIteration_;
+  int solveInIteration_;
+
+  // rhs norm and linear tolerance of the previous solve in this time step
+  double forcingResidual_;
+  double forcingTerm_;
+
+  // bytes sent by the rhs and matrix exports of loadComplete
+  void recordExport();
+
+  // per-solve statistics; rank 0 only, opened on the first logged solve
+  void logSolve(
+    const TpetraLinearSolver & linearSolver,
+    const int iterations,
+    const double initialResidual,
+    const double finalResidual);
+  std::ofstream solverLog_;
+
+  // MueLu prolongators of the upper levels from the uniform refinement
+  // hierarchy when the config asks for them (muelu_geometric_levels); node
+  // matrices only
+  void setupGeometricProlongators(
+    TpetraLinearSolver & linearSolver);
+
+  // binary capture of the matrix, rhs and coordinates of this solve when
+  // the config asks for it (capture_step)
+  void captureSystem(
+    const TpetraLinearSolverConfig & config,
+    const LinSys::MultiVector & rhs);
+
+  // device assembly leaves the rhs modified in the device space; host
+  // writers sync it back first (device_resident)
+  void syncRhsToHost();
+  bool deviceResident_;
+  bool rhsOnDevice_;
 };
 
 
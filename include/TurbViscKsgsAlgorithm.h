@@ -17,6 +17,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EffectiveDiffFluxCoeffAlgorithm;
 
 class TurbViscKsgsAlgorithm : public Algorithm
 {
@@ -24,8 +25,9 @@ public:
   
   TurbViscKsgsAlgorithm(
     Realm &realm,
-    stk::mesh::Part *part);
-  virtual ~TurbViscKsgsAlgorithm() {}
+    stk::mesh::Part *part,
+    EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg = NULL);
+  virtual ~TurbViscKsgsAlgorithm();
   virtual void execute();
 
   ScalarFieldType *tke_;
@@ -34,7 +36,10 @@ public:
   ScalarFieldType *dualNodalVolume_;
 
   const double cmuEps_;
-  
+
+  // optional; evaluated per bucket right after tvisc (owned)
+  EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg_;
+
 };
 
 } // namespace nalu
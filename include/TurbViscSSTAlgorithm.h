@@ -17,6 +17,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EffectiveDiffFluxCoeffAlgorithm;
 
 class TurbViscSSTAlgorithm : public Algorithm
 {
@@ -24,8 +25,9 @@ public:
   
   TurbViscSSTAlgorithm(
     Realm &realm,
-    stk::mesh::Part *part);
-  virtual ~TurbViscSSTAlgorithm() {}
+    stk::mesh::Part *part,
+    EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg = NULL);
+  virtual ~TurbViscSSTAlgorithm();
   virtual void execute();
 
   const double aOne_;
@@ -38,7 +40,10 @@ public:
   ScalarFieldType *minDistance_;
   GenericFieldType *dudx_;
   ScalarFieldType *tvisc_;
-  
+
+  // optional; evaluated per bucket right after tvisc (owned)
+  EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg_;
+
 };
 
 } // namespace nalu
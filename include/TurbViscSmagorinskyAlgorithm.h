@@ -17,6 +17,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EffectiveDiffFluxCoeffAlgorithm;
 
 class TurbViscSmagorinskyAlgorithm : public Algorithm
 {
@@ -24,8 +25,9 @@ public:
   
   TurbViscSmagorinskyAlgorithm(
     Realm &realm,
-    stk::mesh::Part *part);
-  virtual ~TurbViscSmagorinskyAlgorithm() {}
+    stk::mesh::Part *part,
+    EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg = NULL);
+  virtual ~TurbViscSmagorinskyAlgorithm();
   virtual void execute();
 
   GenericFieldType *dudx_;
@@ -34,7 +36,10 @@ public:
   ScalarFieldType *dualNodalVolume_;
 
   const double cmuCs_;
-  
+
+  // optional; evaluated per bucket right after tvisc (owned)
+  EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg_;
+
 };
 
 } // namespace nalu
@@ -17,6 +17,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class EffectiveDiffFluxCoeffAlgorithm;
 
 class TurbViscWaleAlgorithm : public Algorithm
 {
@@ -24,8 +25,9 @@ public:
   
   TurbViscWaleAlgorithm(
     Realm &realm,
-    stk::mesh::Part *part);
-  virtual ~TurbViscWaleAlgorithm() {}
+    stk::mesh::Part *part,
+    EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg = NULL);
+  virtual ~TurbViscWaleAlgorithm();
   virtual void execute();
 
   GenericFieldType *dudx_;
@@ -35,7 +37,10 @@ public:
 
   const double Cw_;
   const double kappa_;
-  
+
+  // optional; evaluated per bucket right after tvisc (owned)
+  EffectiveDiffFluxCoeffAlgorithm *effDiffFluxCoeffAlg_;
+
 };
 
 } // namespace nalu
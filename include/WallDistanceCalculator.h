@@ -0,0 +1,107 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef WallDistanceCalculator_h
+#define WallDistanceCalculator_h
+
+#include <FieldTypeDef.h>
+
+// stk
+#include <stk_mesh/base/Part.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
+#include <stk_search/SearchMethod.hpp>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// WallDistanceCalculator
+//=============================================================================
+/**
+ * * @par Description:
+ * - exact minimum distance from every node of a set of parts to a set of
+ *   wall faces (e.g., minimum_distance_to_wall for SST/DES or the matching
+ *   distance of a wall model).
+ *
+ * @par Design Considerations:
+ * - the wall faces stay distributed; a coarse search of a sphere about each
+ *   node against the face boxes (r-tree) finds the candidates, and only the
+ *   geometry of remote candidates is sent to the node's processor.  A node
+ *   is final once its closest candidate lies within the search radius;
+ *   otherwise the radius grows and the node is searched again.
+ * - faces are represented by their vertices; quadrilaterals are split into
+ *   two triangles and higher order faces use their linear skeleton.
+ */
+//=============================================================================
+class WallDistanceCalculator {
+
+ public:
+
+  typedef stk::search::IdentProc<uint64_t,int> theKey;
+  typedef stk::search::Point<double> Point;
+  typedef stk::search::Box<double> Box;
+  typedef stk::search::Sphere<double> Sphere;
+  typedef std::pair<Box,theKey> boundingFaceBox;
+  typedef std::pair<Sphere,theKey> boundingSphere;
+
+  WallDistanceCalculator(
+    Realm &realm,
+    const stk::mesh::PartVector &wallParts,
+    const stk::mesh::PartVector &targetParts,
+    ScalarFieldType *wallDistance);
+  ~WallDistanceCalculator();
+
+  // fill wallDistance on the locally owned and shared nodes of the target parts
+  void execute();
+
+  // distance from a point to a face of numVertices (2, 3 or 4) vertices
+  static double point_face_distance(
+    const int nDim,
+    const double *x,
+    const int numVertices,
+    const double *vertices);
+
+ private:
+
+  void gather_wall_faces();
+  void gather_target_nodes();
+  void search_pass(
+    const std::vector<size_t> &activeNodes);
+
+  Realm &realm_;
+  const stk::mesh::PartVector wallParts_;
+  const stk::mesh::PartVector targetParts_;
+  ScalarFieldType *wallDistance_;
+  const int nDim_;
+
+  // locally owned wall faces; vertex coordinates packed per face
+  std::vector<boundingFaceBox> faceBoxVec_;
+  std::vector<int> faceNumVertices_;
+  std::vector<size_t> faceOffset_;
+  std::vector<double> faceVertices_;
+
+  // target nodes, their current search radius and closest distance
+  std::vector<stk::mesh::Entity> nodeVec_;
+  std::vector<double> nodeCoords_;
+  std::vector<double> radius_;
+  std::vector<double> distance_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
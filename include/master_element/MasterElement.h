@@ -29,6 +29,32 @@ enum Direction
 };
 }
 
+// integration points of a P2 tensor-product element that lie on a grid of
+// 1D points; jacobians at the grid are found by contracting the nodal
+// coordinates one direction at a time rather than summing every node at
+// every ip
+struct TensorProductGrid
+{
+  enum { maxPoints1D_ = 8 };
+
+  TensorProductGrid();
+
+  void set_points(
+    const int direction,
+    const std::vector<double> &points);
+
+  int grid_point(int s1Point, int s2Point, int s3Point = 0) const {
+    return s1Point + numPoints_[0]*(s2Point + numPoints_[1]*s3Point); }
+
+  // quadratic Lagrange basis and derivative, (point, node1D)
+  int numPoints_[3];
+  std::vector<double> basis_[3];
+  std::vector<double> deriv_[3];
+
+  // grid point (s1 fastest) -> ip ordinal
+  std::vector<int> ipOrdinal_;
+};
+
 class MasterElement
 {
 public:
@@ -347,6 +373,12 @@ protected:
     int s1Node, int s2Node,
     int s1Ip, int s2Ip) const;
 
+  // jacobian (ip, component, direction) at every ip of the grid
+  void tensor_product_jacobian(
+    const TensorProductGrid &grid,
+    const double *elemNodalCoords,
+    double *jacobian) const;
+
   virtual void eval_shape_functions_at_ips();
   virtual void eval_shape_functions_at_shifted_ips();
 
@@ -410,11 +442,8 @@ public:
 private:
   void set_interior_info();
 
-  double jacobian_determinant(
-    const double *elemNodalCoords,
-    const double *shapeDerivs ) const;
-
   std::vector<double> ipWeight_;
+  TensorProductGrid ipGrid_;
 };
 
 // 3D Hex 27 subcontrol surface
@@ -476,8 +505,7 @@ private:
 
   void area_vector(
     const Jacobian::Direction direction,
-    const double *elemNodalCoords,
-    double *shapeDeriv,
+    const double *jacobian,
     double *areaVector ) const;
 
   void gradient(
@@ -486,8 +514,23 @@ private:
     double* grad,
     double* det_j ) const;
 
+  void jacobian_gradient(
+    const double* jacobian,
+    const double* shapeDeriv,
+    double* grad,
+    double* det_j ) const;
+
+  void scs_jacobian(
+    const std::vector<TensorProductGrid> &grids,
+    const double *elemNodalCoords,
+    double *jacobian ) const;
+
   std::vector<ContourData> ipInfo_;
   int ipsPerFace_;
+
+  // one grid per surface direction
+  std::vector<TensorProductGrid> ipGrids_;
+  std::vector<TensorProductGrid> ipGridsShift_;
 };
 
 // Tet 4 subcontrol volume
@@ -946,6 +989,12 @@ protected:
 
   double tensor_product_weight(int s1Node, int s1Ip) const;
 
+  // jacobian (ip, component, direction) at every ip of the grid
+  void tensor_product_jacobian(
+    const TensorProductGrid &grid,
+    const double *elemNodalCoords,
+    double *jacobian) const;
+
   void eval_shape_functions_at_ips();
   void eval_shape_functions_at_shifted_ips();
 
@@ -1005,11 +1054,8 @@ public:
 private:
   void set_interior_info();
 
-  double jacobian_determinant(
-    const double *elemNodalCoords,
-    const double *shapeDerivs ) const;
-
   std::vector<double> ipWeight_;
+  TensorProductGrid ipGrid_;
 };
 
 // 3D Hex 27 subcontrol surface
@@ -1071,12 +1117,14 @@ private:
 
   void area_vector(
     const Jacobian::Direction direction,
-    const double *elemNodalCoords,
-    double *shapeDeriv,
+    const double *jacobian,
     double *areaVector ) const;
 
   std::vector<ContourData> ipInfo_;
   int ipsPerFace_;
+
+  // one grid per surface direction
+  std::vector<TensorProductGrid> ipGrids_;
 };
 
 // 2D Tri 3 subcontrol volume
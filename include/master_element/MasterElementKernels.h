@@ -0,0 +1,727 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MasterElementKernels_h
+#define MasterElementKernels_h
+
+// header-only master element kernels with compile-time sizes; the virtual
+// MasterElement interface forwards to these and hot assembly loops may call
+// them directly once the topology is known
+
+#include <cmath>
+
+namespace sierra{
+namespace nalu{
+
+//==========================================================================
+// topology traits; node and integration point counts of each master element
+//==========================================================================
+struct Hex8Traits   { enum { nDim_ = 3, nodesPerElement_ = 8,  numScsIp_ = 12,  numScvIp_ = 8   }; };
+struct Hex27Traits  { enum { nDim_ = 3, nodesPerElement_ = 27, numScsIp_ = 216, numScvIp_ = 216 }; };
+struct Tet4Traits   { enum { nDim_ = 3, nodesPerElement_ = 4,  numScsIp_ = 6,   numScvIp_ = 4   }; };
+struct Pyr5Traits   { enum { nDim_ = 3, nodesPerElement_ = 5,  numScsIp_ = 8,   numScvIp_ = 5   }; };
+struct Wed6Traits   { enum { nDim_ = 3, nodesPerElement_ = 6,  numScsIp_ = 9,   numScvIp_ = 6   }; };
+struct Quad42DTraits{ enum { nDim_ = 2, nodesPerElement_ = 4,  numScsIp_ = 4,   numScvIp_ = 4   }; };
+struct Tri32DTraits { enum { nDim_ = 2, nodesPerElement_ = 3,  numScsIp_ = 3,   numScvIp_ = 3   }; };
+
+//==========================================================================
+// isoparametric gradient operator; a port of the *_gradient_operator
+// Fortran in MasterElementWork.F, not checked against it by any test
+//==========================================================================
+// deriv(nDim,npe,nint), coords(nDim,npe,nelem), gradop(nDim,npe,nelem,nint),
+// det_j(nelem,nint), error(nelem); returns the (one-based) last element that
+// fails the positive volume check, zero otherwise
+template <int nDim, int npe, int nint>
+struct GradientOperator;
+
+template <int npe, int nint>
+struct GradientOperator<3, npe, nint>
+{
+  static int compute(
+    const int nelem,
+    const double *deriv,
+    const double *coords,
+    double *gradop,
+    double *det_j,
+    double *error)
+  {
+    const double realmin = 2.2250738585072014e-308;
+    int nerr = 0;
+
+    for ( int ke = 0; ke < nelem; ++ke )
+      error[ke] = 0.0;
+
+    for ( int ki = 0; ki < nint; ++ki ) {
+      const double *p_deriv = deriv + ki*npe*3;
+      for ( int ke = 0; ke < nelem; ++ke ) {
+        const double *p_coords = coords + ke*npe*3;
+
+        // jacobian at the integration station
+        double dx_ds1 = 0.0, dx_ds2 = 0.0, dx_ds3 = 0.0;
+        double dy_ds1 = 0.0, dy_ds2 = 0.0, dy_ds3 = 0.0;
+        double dz_ds1 = 0.0, dz_ds2 = 0.0, dz_ds3 = 0.0;
+        for ( int kn = 0; kn < npe; ++kn ) {
+          const double d1 = p_deriv[kn*3+0];
+          const double d2 = p_deriv[kn*3+1];
+          const double d3 = p_deriv[kn*3+2];
+          const double x = p_coords[kn*3+0];
+          const double y = p_coords[kn*3+1];
+          const double z = p_coords[kn*3+2];
+          dx_ds1 += d1*x; dx_ds2 += d2*x; dx_ds3 += d3*x;
+          dy_ds1 += d1*y; dy_ds2 += d2*y; dy_ds3 += d3*y;
+          dz_ds1 += d1*z; dz_ds2 += d2*z; dz_ds3 += d3*z;
+        }
+
+        const double detj = dx_ds1*( dy_ds2*dz_ds3 - dz_ds2*dy_ds3 )
+          + dy_ds1*( dz_ds2*dx_ds3 - dx_ds2*dz_ds3 )
+          + dz_ds1*( dx_ds2*dy_ds3 - dy_ds2*dx_ds3 );
+        det_j[ki*nelem+ke] = detj;
+
+        // protect against a negative or small value of the determinant
+        double test = detj;
+        if ( test <= 1.0e6*realmin ) {
+          test = 1.0;
+          error[ke] = 1.0;
+        }
+        const double denom = 1.0/test;
+
+        const double ds1_dx = denom*(dy_ds2*dz_ds3 - dz_ds2*dy_ds3);
+        const double ds2_dx = denom*(dz_ds1*dy_ds3 - dy_ds1*dz_ds3);
+        const double ds3_dx = denom*(dy_ds1*dz_ds2 - dz_ds1*dy_ds2);
+
+        const double ds1_dy = denom*(dz_ds2*dx_ds3 - dx_ds2*dz_ds3);
+        const double ds2_dy = denom*(dx_ds1*dz_ds3 - dz_ds1*dx_ds3);
+        const double ds3_dy = denom*(dz_ds1*dx_ds2 - dx_ds1*dz_ds2);
+
+        const double ds1_dz = denom*(dx_ds2*dy_ds3 - dy_ds2*dx_ds3);
+        const double ds2_dz = denom*(dy_ds1*dx_ds3 - dx_ds1*dy_ds3);
+        const double ds3_dz = denom*(dx_ds1*dy_ds2 - dy_ds1*dx_ds2);
+
+        double *p_gradop = gradop + (ki*nelem + ke)*npe*3;
+        for ( int kn = 0; kn < npe; ++kn ) {
+          const double d1 = p_deriv[kn*3+0];
+          const double d2 = p_deriv[kn*3+1];
+          const double d3 = p_deriv[kn*3+2];
+          p_gradop[kn*3+0] = d1*ds1_dx + d2*ds2_dx + d3*ds3_dx;
+          p_gradop[kn*3+1] = d1*ds1_dy + d2*ds2_dy + d3*ds3_dy;
+          p_gradop[kn*3+2] = d1*ds1_dz + d2*ds2_dz + d3*ds3_dz;
+        }
+      }
+    }
+
+    for ( int ke = 0; ke < nelem; ++ke )
+      if ( error[ke] != 0.0 ) nerr = ke+1;
+
+    return nerr;
+  }
+};
+
+template <int npe, int nint>
+struct GradientOperator<2, npe, nint>
+{
+  static int compute(
+    const int nelem,
+    const double *deriv,
+    const double *coords,
+    double *gradop,
+    double *det_j,
+    double *error)
+  {
+    const double realmin = 2.2250738585072014e-308;
+    int nerr = 0;
+
+    for ( int ke = 0; ke < nelem; ++ke )
+      error[ke] = 0.0;
+
+    for ( int ki = 0; ki < nint; ++ki ) {
+      const double *p_deriv = deriv + ki*npe*2;
+      for ( int ke = 0; ke < nelem; ++ke ) {
+        const double *p_coords = coords + ke*npe*2;
+
+        // jacobian at the integration station
+        double dx_ds1 = 0.0, dx_ds2 = 0.0;
+        double dy_ds1 = 0.0, dy_ds2 = 0.0;
+        for ( int kn = 0; kn < npe; ++kn ) {
+          const double d1 = p_deriv[kn*2+0];
+          const double d2 = p_deriv[kn*2+1];
+          const double x = p_coords[kn*2+0];
+          const double y = p_coords[kn*2+1];
+          dx_ds1 += d1*x; dx_ds2 += d2*x;
+          dy_ds1 += d1*y; dy_ds2 += d2*y;
+        }
+
+        const double detj = dx_ds1*dy_ds2 - dy_ds1*dx_ds2;
+        det_j[ki*nelem+ke] = detj;
+
+        // protect against a negative or small value of the determinant
+        double test = detj;
+        if ( test <= 1.0e6*realmin ) {
+          test = 1.0;
+          error[ke] = 1.0;
+        }
+        const double denom = 1.0/test;
+
+        const double ds1_dx =  denom*dy_ds2;
+        const double ds2_dx = -denom*dy_ds1;
+        const double ds1_dy = -denom*dx_ds2;
+        const double ds2_dy =  denom*dx_ds1;
+
+        double *p_gradop = gradop + (ki*nelem + ke)*npe*2;
+        for ( int kn = 0; kn < npe; ++kn ) {
+          const double d1 = p_deriv[kn*2+0];
+          const double d2 = p_deriv[kn*2+1];
+          p_gradop[kn*2+0] = d1*ds1_dx + d2*ds2_dx;
+          p_gradop[kn*2+1] = d1*ds1_dy + d2*ds2_dy;
+        }
+      }
+    }
+
+    for ( int ke = 0; ke < nelem; ++ke )
+      if ( error[ke] != 0.0 ) nerr = ke+1;
+
+    return nerr;
+  }
+};
+
+// convenience wrappers keyed on the topology traits
+template <class Traits>
+inline int scs_gradient_operator(
+  const int nelem, const double *deriv, const double *coords,
+  double *gradop, double *det_j, double *error)
+{
+  return GradientOperator<Traits::nDim_, Traits::nodesPerElement_, Traits::numScsIp_>::compute(
+    nelem, deriv, coords, gradop, det_j, error);
+}
+
+template <class Traits>
+inline int scv_gradient_operator(
+  const int nelem, const double *deriv, const double *coords,
+  double *gradop, double *det_j, double *error)
+{
+  return GradientOperator<Traits::nDim_, Traits::nodesPerElement_, Traits::numScvIp_>::compute(
+    nelem, deriv, coords, gradop, det_j, error);
+}
+
+//==========================================================================
+// shape function derivatives; par_coord(nDim,npts), deriv(nDim,npe,npts)
+//==========================================================================
+template <int npts>
+inline void hex8_derivative(
+  const double *par_coord,
+  double *deriv)
+{
+  const double half = 0.5;
+  const double one4th = 0.25;
+  for ( int j = 0; j < npts; ++j ) {
+    const double s1 = par_coord[j*3+0];
+    const double s2 = par_coord[j*3+1];
+    const double s3 = par_coord[j*3+2];
+    const double s1s2 = s1*s2;
+    const double s2s3 = s2*s3;
+    const double s1s3 = s1*s3;
+    double *d = deriv + j*24;
+
+    // shape function derivative in the s1 direction
+    d[0*3+0] = half*( s3 + s2 ) - s2s3 - one4th;
+    d[1*3+0] = half*(-s3 - s2 ) + s2s3 + one4th;
+    d[2*3+0] = half*(-s3 + s2 ) - s2s3 + one4th;
+    d[3*3+0] = half*(+s3 - s2 ) + s2s3 - one4th;
+    d[4*3+0] = half*(-s3 + s2 ) + s2s3 - one4th;
+    d[5*3+0] = half*(+s3 - s2 ) - s2s3 + one4th;
+    d[6*3+0] = half*(+s3 + s2 ) + s2s3 + one4th;
+    d[7*3+0] = half*(-s3 - s2 ) - s2s3 - one4th;
+
+    // shape function derivative in the s2 direction
+    d[0*3+1] = half*( s3 + s1 ) - s1s3 - one4th;
+    d[1*3+1] = half*( s3 - s1 ) + s1s3 - one4th;
+    d[2*3+1] = half*(-s3 + s1 ) - s1s3 + one4th;
+    d[3*3+1] = half*(-s3 - s1 ) + s1s3 + one4th;
+    d[4*3+1] = half*(-s3 + s1 ) + s1s3 - one4th;
+    d[5*3+1] = half*(-s3 - s1 ) - s1s3 - one4th;
+    d[6*3+1] = half*( s3 + s1 ) + s1s3 + one4th;
+    d[7*3+1] = half*( s3 - s1 ) - s1s3 + one4th;
+
+    // shape function derivative in the s3 direction
+    d[0*3+2] = half*( s2 + s1 ) - s1s2 - one4th;
+    d[1*3+2] = half*( s2 - s1 ) + s1s2 - one4th;
+    d[2*3+2] = half*(-s2 - s1 ) - s1s2 - one4th;
+    d[3*3+2] = half*(-s2 + s1 ) + s1s2 - one4th;
+    d[4*3+2] = half*(-s2 - s1 ) + s1s2 + one4th;
+    d[5*3+2] = half*(-s2 + s1 ) - s1s2 + one4th;
+    d[6*3+2] = half*( s2 + s1 ) + s1s2 + one4th;
+    d[7*3+2] = half*( s2 - s1 ) - s1s2 + one4th;
+  }
+}
+
+template <int npts>
+inline void tet4_derivative(
+  double *deriv)
+{
+  for ( int j = 0; j < npts; ++j ) {
+    double *d = deriv + j*12;
+    d[0] = -1.0; d[1]  = -1.0; d[2]  = -1.0;
+    d[3] =  1.0; d[4]  =  0.0; d[5]  =  0.0;
+    d[6] =  0.0; d[7]  =  1.0; d[8]  =  0.0;
+    d[9] =  0.0; d[10] =  0.0; d[11] =  1.0;
+  }
+}
+
+template <int npts>
+inline void quad4_derivative(
+  const double *par_coord,
+  double *deriv)
+{
+  const double half = 0.5;
+  for ( int j = 0; j < npts; ++j ) {
+    const double s1 = par_coord[j*2+0];
+    const double s2 = par_coord[j*2+1];
+    double *d = deriv + j*8;
+
+    // shape function derivative in the s1 direction
+    d[0*2+0] = - half + s2;
+    d[1*2+0] =   half - s2;
+    d[2*2+0] =   half + s2;
+    d[3*2+0] = - half - s2;
+
+    // shape function derivative in the s2 direction
+    d[0*2+1] = - half + s1;
+    d[1*2+1] = - half - s1;
+    d[2*2+1] =   half + s1;
+    d[3*2+1] =   half - s1;
+  }
+}
+
+template <int npts>
+inline void tri3_derivative(
+  double *deriv)
+{
+  for ( int j = 0; j < npts; ++j ) {
+    double *d = deriv + j*6;
+    d[0] = -1.0; d[1] = -1.0;
+    d[2] =  1.0; d[3] =  0.0;
+    d[4] =  0.0; d[5] =  1.0;
+  }
+}
+
+//==========================================================================
+// subcontrol surface area vectors
+//==========================================================================
+// area vector of a quadrilateral by decomposition into four triangles about
+// its centroid; quadAreaByTriangleFacets
+inline void quad_area_by_triangle_facets(
+  const double *areacoords,
+  double *area)
+{
+  double xmid[3];
+  double r1[3];
+  double r2[3];
+  for ( int k = 0; k < 3; ++k ) {
+    xmid[k] = 0.25*( areacoords[0*3+k] + areacoords[1*3+k]
+                     + areacoords[2*3+k] + areacoords[3*3+k] );
+    area[k] = 0.0;
+    r2[k] = areacoords[0*3+k] - xmid[k];
+  }
+
+  // triangles (mid,1,2), (mid,2,3), (mid,3,4), (mid,4,1)
+  for ( int itri = 0; itri < 4; ++itri ) {
+    const int iq = (itri+1) % 4;
+    for ( int k = 0; k < 3; ++k ) {
+      r1[k] = r2[k];
+      r2[k] = areacoords[iq*3+k] - xmid[k];
+    }
+    area[0] += r1[1]*r2[2] - r2[1]*r1[2];
+    area[1] += r1[2]*r2[0] - r2[2]*r1[0];
+    area[2] += r1[0]*r2[1] - r2[0]*r1[1];
+  }
+
+  for ( int k = 0; k < 3; ++k )
+    area[k] *= 0.5;
+}
+
+// coords(3,8,nelem), areav(3,nelem,12); hex_scs_det
+inline void hex8_scs_det(
+  const int nelem,
+  const double *cordel,
+  double *areav)
+{
+  // subcontrol surfaces in terms of the 27 point (vertex, edge, face,
+  // centroid) layout of the hex; zero-based
+  static const int hexEdgeFacetTable[12][4] = {
+    {20,  8, 12, 26},
+    {24,  9, 12, 26},
+    {10, 12, 26, 23},
+    {11, 25, 26, 12},
+    {13, 20, 26, 17},
+    {17, 14, 24, 26},
+    {17, 15, 23, 26},
+    {16, 17, 26, 25},
+    {19, 20, 26, 25},
+    {20, 18, 24, 26},
+    {22, 23, 26, 24},
+    {21, 25, 26, 23} };
+
+  // edge midpoints and face centroids in terms of the vertices
+  static const int edgeTable[12][2] = {
+    {0, 1}, {1, 2}, {2, 3}, {3, 0},
+    {4, 5}, {5, 6}, {6, 7}, {7, 4},
+    {1, 5}, {0, 4}, {3, 7}, {2, 6} };
+  static const int edgeSlot[12] = {8, 9, 10, 11, 13, 14, 15, 16, 18, 19, 21, 22};
+  static const int faceTable[6][4] = {
+    {0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 4, 5},
+    {2, 3, 6, 7}, {1, 2, 5, 6}, {0, 3, 4, 7} };
+  static const int faceSlot[6] = {12, 17, 20, 23, 24, 25};
+
+  double coords[27][3];
+  double scscoords[4*3];
+
+  for ( int ielem = 0; ielem < nelem; ++ielem ) {
+    const double *c = cordel + ielem*24;
+
+    for ( int j = 0; j < 8; ++j )
+      for ( int k = 0; k < 3; ++k )
+        coords[j][k] = c[j*3+k];
+
+    for ( int e = 0; e < 12; ++e )
+      for ( int k = 0; k < 3; ++k )
+        coords[edgeSlot[e]][k] = 0.5*(c[edgeTable[e][0]*3+k] + c[edgeTable[e][1]*3+k]);
+
+    for ( int f = 0; f < 6; ++f )
+      for ( int k = 0; k < 3; ++k )
+        coords[faceSlot[f]][k] = 0.25*(c[faceTable[f][0]*3+k] + c[faceTable[f][1]*3+k]
+                                       + c[faceTable[f][2]*3+k] + c[faceTable[f][3]*3+k]);
+
+    for ( int k = 0; k < 3; ++k )
+      coords[26][k] = 0.125*(c[0*3+k] + c[1*3+k] + c[2*3+k] + c[3*3+k]
+                             + c[4*3+k] + c[5*3+k] + c[6*3+k] + c[7*3+k]);
+
+    for ( int ics = 0; ics < 12; ++ics ) {
+      for ( int inode = 0; inode < 4; ++inode )
+        for ( int k = 0; k < 3; ++k )
+          scscoords[inode*3+k] = coords[hexEdgeFacetTable[ics][inode]][k];
+      quad_area_by_triangle_facets(scscoords, areav + (ics*nelem + ielem)*3);
+    }
+  }
+}
+
+//==========================================================================
+// packed (structure-of-arrays) kernels; geometry for nPack elements at once
+//==========================================================================
+// the element (lane) index runs fastest so that the inner loops vectorise
+// across the elements of the pack; agreement with the per-element kernels
+// is to round-off, the compiler may contract or reorder the lane loops:
+//   coords(nPack,3,npe), gradop(nPack,3,npe,nint), det_j(nPack,nint),
+//   areav(nPack,3,nscs), error(nPack)
+template <int npe, int nint, int nPack>
+struct GradientOperatorPack3D
+{
+  static int compute(
+    const double *deriv,
+    const double *coords,
+    double *gradop,
+    double *det_j,
+    double *error)
+  {
+    const double realmin = 2.2250738585072014e-308;
+    int nerr = 0;
+
+    for ( int l = 0; l < nPack; ++l )
+      error[l] = 0.0;
+
+    for ( int ki = 0; ki < nint; ++ki ) {
+      const double *p_deriv = deriv + ki*npe*3;
+
+      double dx_ds1[nPack], dx_ds2[nPack], dx_ds3[nPack];
+      double dy_ds1[nPack], dy_ds2[nPack], dy_ds3[nPack];
+      double dz_ds1[nPack], dz_ds2[nPack], dz_ds3[nPack];
+      for ( int l = 0; l < nPack; ++l ) {
+        dx_ds1[l] = 0.0; dx_ds2[l] = 0.0; dx_ds3[l] = 0.0;
+        dy_ds1[l] = 0.0; dy_ds2[l] = 0.0; dy_ds3[l] = 0.0;
+        dz_ds1[l] = 0.0; dz_ds2[l] = 0.0; dz_ds3[l] = 0.0;
+      }
+
+      // jacobian at the integration station
+      for ( int kn = 0; kn < npe; ++kn ) {
+        const double d1 = p_deriv[kn*3+0];
+        const double d2 = p_deriv[kn*3+1];
+        const double d3 = p_deriv[kn*3+2];
+        const double *x = coords + (kn*3+0)*nPack;
+        const double *y = coords + (kn*3+1)*nPack;
+        const double *z = coords + (kn*3+2)*nPack;
+        for ( int l = 0; l < nPack; ++l ) {
+          dx_ds1[l] += d1*x[l]; dx_ds2[l] += d2*x[l]; dx_ds3[l] += d3*x[l];
+          dy_ds1[l] += d1*y[l]; dy_ds2[l] += d2*y[l]; dy_ds3[l] += d3*y[l];
+          dz_ds1[l] += d1*z[l]; dz_ds2[l] += d2*z[l]; dz_ds3[l] += d3*z[l];
+        }
+      }
+
+      double ds_dx[9][nPack];
+      for ( int l = 0; l < nPack; ++l ) {
+        const double detj = dx_ds1[l]*( dy_ds2[l]*dz_ds3[l] - dz_ds2[l]*dy_ds3[l] )
+          + dy_ds1[l]*( dz_ds2[l]*dx_ds3[l] - dx_ds2[l]*dz_ds3[l] )
+          + dz_ds1[l]*( dx_ds2[l]*dy_ds3[l] - dy_ds2[l]*dx_ds3[l] );
+        det_j[ki*nPack+l] = detj;
+
+        // protect against a negative or small value of the determinant
+        const bool bad = detj <= 1.0e6*realmin;
+        error[l] = bad ? 1.0 : error[l];
+        const double denom = 1.0/(bad ? 1.0 : detj);
+
+        ds_dx[0][l] = denom*(dy_ds2[l]*dz_ds3[l] - dz_ds2[l]*dy_ds3[l]);
+        ds_dx[1][l] = denom*(dz_ds1[l]*dy_ds3[l] - dy_ds1[l]*dz_ds3[l]);
+        ds_dx[2][l] = denom*(dy_ds1[l]*dz_ds2[l] - dz_ds1[l]*dy_ds2[l]);
+
+        ds_dx[3][l] = denom*(dz_ds2[l]*dx_ds3[l] - dx_ds2[l]*dz_ds3[l]);
+        ds_dx[4][l] = denom*(dx_ds1[l]*dz_ds3[l] - dz_ds1[l]*dx_ds3[l]);
+        ds_dx[5][l] = denom*(dz_ds1[l]*dx_ds2[l] - dx_ds1[l]*dz_ds2[l]);
+
+        ds_dx[6][l] = denom*(dx_ds2[l]*dy_ds3[l] - dy_ds2[l]*dx_ds3[l]);
+        ds_dx[7][l] = denom*(dy_ds1[l]*dx_ds3[l] - dx_ds1[l]*dy_ds3[l]);
+        ds_dx[8][l] = denom*(dx_ds1[l]*dy_ds2[l] - dy_ds1[l]*dx_ds2[l]);
+      }
+
+      for ( int kn = 0; kn < npe; ++kn ) {
+        const double d1 = p_deriv[kn*3+0];
+        const double d2 = p_deriv[kn*3+1];
+        const double d3 = p_deriv[kn*3+2];
+        double *gx = gradop + ((ki*npe + kn)*3+0)*nPack;
+        double *gy = gradop + ((ki*npe + kn)*3+1)*nPack;
+        double *gz = gradop + ((ki*npe + kn)*3+2)*nPack;
+        for ( int l = 0; l < nPack; ++l ) {
+          gx[l] = d1*ds_dx[0][l] + d2*ds_dx[1][l] + d3*ds_dx[2][l];
+          gy[l] = d1*ds_dx[3][l] + d2*ds_dx[4][l] + d3*ds_dx[5][l];
+          gz[l] = d1*ds_dx[6][l] + d2*ds_dx[7][l] + d3*ds_dx[8][l];
+        }
+      }
+    }
+
+    for ( int l = 0; l < nPack; ++l )
+      if ( error[l] != 0.0 ) nerr = l+1;
+
+    return nerr;
+  }
+};
+
+// packed hex_scs_det; see hex8_scs_det for the subcontrol surface layout
+template <int nPack>
+inline void hex8_scs_det_pack(
+  const double *cordel,
+  double *areav)
+{
+  static const int hexEdgeFacetTable[12][4] = {
+    {20,  8, 12, 26},
+    {24,  9, 12, 26},
+    {10, 12, 26, 23},
+    {11, 25, 26, 12},
+    {13, 20, 26, 17},
+    {17, 14, 24, 26},
+    {17, 15, 23, 26},
+    {16, 17, 26, 25},
+    {19, 20, 26, 25},
+    {20, 18, 24, 26},
+    {22, 23, 26, 24},
+    {21, 25, 26, 23} };
+  static const int edgeTable[12][2] = {
+    {0, 1}, {1, 2}, {2, 3}, {3, 0},
+    {4, 5}, {5, 6}, {6, 7}, {7, 4},
+    {1, 5}, {0, 4}, {3, 7}, {2, 6} };
+  static const int edgeSlot[12] = {8, 9, 10, 11, 13, 14, 15, 16, 18, 19, 21, 22};
+  static const int faceTable[6][4] = {
+    {0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 4, 5},
+    {2, 3, 6, 7}, {1, 2, 5, 6}, {0, 3, 4, 7} };
+  static const int faceSlot[6] = {12, 17, 20, 23, 24, 25};
+
+  double coords[27][3][nPack];
+
+  for ( int j = 0; j < 8; ++j )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[j][k][l] = cordel[(j*3+k)*nPack+l];
+
+  for ( int e = 0; e < 12; ++e )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[edgeSlot[e]][k][l] = 0.5*(coords[edgeTable[e][0]][k][l] + coords[edgeTable[e][1]][k][l]);
+
+  for ( int f = 0; f < 6; ++f )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[faceSlot[f]][k][l] = 0.25*(coords[faceTable[f][0]][k][l] + coords[faceTable[f][1]][k][l]
+                                          + coords[faceTable[f][2]][k][l] + coords[faceTable[f][3]][k][l]);
+
+  for ( int k = 0; k < 3; ++k )
+    for ( int l = 0; l < nPack; ++l )
+      coords[26][k][l] = 0.125*(coords[0][k][l] + coords[1][k][l] + coords[2][k][l] + coords[3][k][l]
+                                + coords[4][k][l] + coords[5][k][l] + coords[6][k][l] + coords[7][k][l]);
+
+  for ( int ics = 0; ics < 12; ++ics ) {
+    const int *facet = hexEdgeFacetTable[ics];
+    double *ax = areav + (ics*3+0)*nPack;
+    double *ay = areav + (ics*3+1)*nPack;
+    double *az = areav + (ics*3+2)*nPack;
+    for ( int l = 0; l < nPack; ++l ) {
+      double xmid[3];
+      for ( int k = 0; k < 3; ++k )
+        xmid[k] = 0.25*( coords[facet[0]][k][l] + coords[facet[1]][k][l]
+                         + coords[facet[2]][k][l] + coords[facet[3]][k][l] );
+
+      // four triangles about the facet centroid
+      double area[3] = {0.0, 0.0, 0.0};
+      double r2[3];
+      for ( int k = 0; k < 3; ++k )
+        r2[k] = coords[facet[0]][k][l] - xmid[k];
+      for ( int itri = 0; itri < 4; ++itri ) {
+        const int iq = facet[(itri+1) % 4];
+        double r1[3];
+        for ( int k = 0; k < 3; ++k ) {
+          r1[k] = r2[k];
+          r2[k] = coords[iq][k][l] - xmid[k];
+        }
+        area[0] += r1[1]*r2[2] - r2[1]*r1[2];
+        area[1] += r1[2]*r2[0] - r2[2]*r1[0];
+        area[2] += r1[0]*r2[1] - r2[0]*r1[1];
+      }
+      ax[l] = 0.5*area[0];
+      ay[l] = 0.5*area[1];
+      az[l] = 0.5*area[2];
+    }
+  }
+}
+
+// packed hex_scv_det; the subcontrol volume of each vertex is the hex of
+// the vertex, its edge midpoints, face centroids and the centroid, with the
+// volume by the triangular facets of hexVolumeByTriangleFacets;
+// volume(nPack,8)
+template <int nPack>
+inline void hex8_scv_det_pack(
+  const double *cordel,
+  double *volume)
+{
+  static const int hexSubcontrolNodeTable[8][8] = {
+    {0,  8, 12, 11, 19, 20, 26, 25},
+    {8,  1,  9, 12, 20, 18, 24, 26},
+    {12, 9,  2, 10, 26, 24, 22, 23},
+    {11, 12, 10, 3, 25, 26, 23, 21},
+    {19, 20, 26, 25, 4, 13, 17, 16},
+    {20, 18, 24, 26, 13, 5, 14, 17},
+    {26, 24, 22, 23, 17, 14, 6, 15},
+    {25, 26, 23, 21, 16, 17, 15, 7} };
+  // facets of a hex by its vertices (0-7) and face centroids (8-13)
+  static const int hexFaceTable[6][4] = {
+    {0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 5, 4},
+    {3, 2, 6, 7}, {1, 2, 6, 5}, {0, 3, 7, 4} };
+  static const int triangularFacetTable[24][3] = {
+    {0, 8, 1},  {8, 2, 1},  {3, 2, 8},  {3, 8, 0},
+    {6, 9, 5},  {7, 9, 6},  {4, 9, 7},  {4, 5, 9},
+    {10, 0, 1}, {5, 10, 1}, {4, 10, 5}, {4, 0, 10},
+    {7, 6, 11}, {6, 2, 11}, {2, 3, 11}, {3, 7, 11},
+    {6, 12, 2}, {5, 12, 6}, {5, 1, 12}, {1, 2, 12},
+    {0, 4, 13}, {4, 7, 13}, {7, 3, 13}, {3, 0, 13} };
+  static const int edgeTable[12][2] = {
+    {0, 1}, {1, 2}, {2, 3}, {3, 0},
+    {4, 5}, {5, 6}, {6, 7}, {7, 4},
+    {1, 5}, {0, 4}, {3, 7}, {2, 6} };
+  static const int edgeSlot[12] = {8, 9, 10, 11, 13, 14, 15, 16, 18, 19, 21, 22};
+  static const int faceTable[6][4] = {
+    {0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 4, 5},
+    {2, 3, 6, 7}, {1, 2, 5, 6}, {0, 3, 4, 7} };
+  static const int faceSlot[6] = {12, 17, 20, 23, 24, 25};
+
+  double coords[27][3][nPack];
+
+  for ( int j = 0; j < 8; ++j )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[j][k][l] = cordel[(j*3+k)*nPack+l];
+
+  for ( int e = 0; e < 12; ++e )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[edgeSlot[e]][k][l] = 0.5*(coords[edgeTable[e][0]][k][l] + coords[edgeTable[e][1]][k][l]);
+
+  for ( int f = 0; f < 6; ++f )
+    for ( int k = 0; k < 3; ++k )
+      for ( int l = 0; l < nPack; ++l )
+        coords[faceSlot[f]][k][l] = 0.25*(coords[faceTable[f][0]][k][l] + coords[faceTable[f][1]][k][l]
+                                          + coords[faceTable[f][2]][k][l] + coords[faceTable[f][3]][k][l]);
+
+  for ( int k = 0; k < 3; ++k )
+    for ( int l = 0; l < nPack; ++l )
+      coords[26][k][l] = 0.125*(coords[0][k][l] + coords[1][k][l] + coords[2][k][l] + coords[3][k][l]
+                                + coords[4][k][l] + coords[5][k][l] + coords[6][k][l] + coords[7][k][l]);
+
+  for ( int icv = 0; icv < 8; ++icv ) {
+    const int *scv = hexSubcontrolNodeTable[icv];
+
+    double v[14][3][nPack];
+    for ( int n = 0; n < 8; ++n )
+      for ( int k = 0; k < 3; ++k )
+        for ( int l = 0; l < nPack; ++l )
+          v[n][k][l] = coords[scv[n]][k][l];
+    for ( int f = 0; f < 6; ++f )
+      for ( int k = 0; k < 3; ++k )
+        for ( int l = 0; l < nPack; ++l )
+          v[8+f][k][l] = 0.25*(v[hexFaceTable[f][0]][k][l] + v[hexFaceTable[f][1]][k][l]
+                               + v[hexFaceTable[f][2]][k][l] + v[hexFaceTable[f][3]][k][l]);
+
+    // divergence theorem over the facets; 3V = integral of x.n
+    double *vol = volume + icv*nPack;
+    for ( int l = 0; l < nPack; ++l )
+      vol[l] = 0.0;
+    for ( int t = 0; t < 24; ++t ) {
+      const int ip = triangularFacetTable[t][0];
+      const int iq = triangularFacetTable[t][1];
+      const int ir = triangularFacetTable[t][2];
+      for ( int l = 0; l < nPack; ++l ) {
+        const double xface = v[ip][0][l] + v[iq][0][l] + v[ir][0][l];
+        const double yface = v[ip][1][l] + v[iq][1][l] + v[ir][1][l];
+        const double zface = v[ip][2][l] + v[iq][2][l] + v[ir][2][l];
+        const double dxq = v[iq][0][l] - v[ip][0][l];
+        const double dyq = v[iq][1][l] - v[ip][1][l];
+        const double dzq = v[iq][2][l] - v[ip][2][l];
+        const double dxr = v[ir][0][l] - v[ip][0][l];
+        const double dyr = v[ir][1][l] - v[ip][1][l];
+        const double dzr = v[ir][2][l] - v[ip][2][l];
+        vol[l] += xface*(dyq*dzr - dyr*dzq)
+          - yface*(dxq*dzr - dxr*dzq)
+          + zface*(dxq*dyr - dxr*dyq);
+      }
+    }
+    for ( int l = 0; l < nPack; ++l )
+      vol[l] /= 18.0;
+  }
+}
+
+//==========================================================================
+// shifted integration points
+//==========================================================================
+// shape_fcn(nint,npe), lrscv(2,nint); true when every ip interpolates as the
+// midpoint of its left and right nodes (shifted ips of the linear
+// topologies); assembly may then skip the shape functions
+inline bool edge_midpoint_ips(
+  const double *shape_fcn,
+  const int *lrscv,
+  const int nint,
+  const int npe)
+{
+  const double tol = 1.0e-12;
+  for ( int ip = 0; ip < nint; ++ip ) {
+    const int il = lrscv[2*ip];
+    const int ir = lrscv[2*ip+1];
+    for ( int ic = 0; ic < npe; ++ic ) {
+      const double expected = ( ic == il || ic == ir ) ? 0.5 : 0.0;
+      if ( std::abs(shape_fcn[ip*npe+ic] - expected) > tol )
+        return false;
+    }
+  }
+  return true;
+}
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
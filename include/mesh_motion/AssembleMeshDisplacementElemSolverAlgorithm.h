@@ -31,12 +31,14 @@ public:
     Realm &realm,
     stk::mesh::Part *part,
     EquationSystem *eqSystem,
-    const bool deformWrtModelCoords);
+    const bool deformWrtModelCoords,
+    const bool freezeStiffness);
   virtual ~AssembleMeshDisplacementElemSolverAlgorithm() {}
   virtual void initialize_connectivity();
   virtual void execute();
 
   const bool deformWrtModelCoords_;
+  const bool freezeStiffness_;
   VectorFieldType *meshDisplacement_;
   VectorFieldType *coordinates_;
   VectorFieldType *modelCoordinates_;
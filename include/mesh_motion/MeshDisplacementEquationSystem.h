@@ -32,7 +32,8 @@ public:
   MeshDisplacementEquationSystem(
     EquationSystems& equationSystems,
     const bool activateMass,
-    const bool deformWrtModelCoords);
+    const bool deformWrtModelCoords,
+    const bool freezeStiffness);
   virtual ~MeshDisplacementEquationSystem();
 
   void initial_work();
@@ -64,6 +65,9 @@ public:
   
   const bool activateMass_;
   const bool deformWrtModelCoords_;
+  // stiffness on the model coordinates; assembled once and kept with its
+  // preconditioner, only the RHS is updated
+  const bool freezeStiffness_;
   bool isInit_;
   VectorFieldType *meshDisplacement_;
   VectorFieldType *meshVelocity_;
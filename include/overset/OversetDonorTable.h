@@ -0,0 +1,107 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef OversetDonorTable_h
+#define OversetDonorTable_h
+
+//==============================================================================
+// Includes and forwards
+//==============================================================================
+
+#include <stk_mesh/base/Entity.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class MasterElement;
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// OversetDonorTable
+//=============================================================================
+/**
+ * * @par Description:
+ * - orphan node -> donor element table of the overset search, one row per
+ *   orphan held in contiguous arrays (structure of arrays).
+ *
+ * @par Design Considerations:
+ * - the row index doubles as the search ident of the orphan, so no map from
+ *   node id to row is needed.  clear() keeps the capacity, so re-searches of
+ *   a moving mesh reuse the storage.  The donor shape function weights are
+ *   evaluated once by compute_weights() for the constraint assembly and the
+ *   orphan field update, together with the constraint row nodes (orphan
+ *   first, then the donor nodes) and the rows of locally owned orphans.
+ */
+//=============================================================================
+class OversetDonorTable {
+
+ public:
+
+  OversetDonorTable();
+  ~OversetDonorTable();
+
+  // drop all rows; storage is kept
+  void clear(const int nDim);
+
+  // new row for an orphan node at coords; returns its index
+  size_t add_orphan(
+    stk::mesh::Entity node,
+    const double *coords);
+
+  // forget the donor of row i
+  void reset_donor(const size_t i);
+
+  // donor shape functions at the isoparametric coordinates of every row,
+  // constraint row nodes and owned rows
+  void compute_weights(const stk::mesh::BulkData &bulkData);
+
+  size_t size() const { return orphanNode_.size(); }
+
+  const double *iso_par_coords(const size_t i) const { return &isoParCoords_[i*nDim_]; }
+  const double *nodal_coords(const size_t i) const { return &nodalCoords_[i*nDim_]; }
+  const double *weights(const size_t i) const { return &weights_[weightOffset_[i]]; }
+  int num_weights(const size_t i) const { return weightOffset_[i+1] - weightOffset_[i]; }
+  const stk::mesh::Entity *constraint_nodes(const size_t i) const { return &constraintNodes_[weightOffset_[i] + i]; }
+
+  int nDim_;
+
+  // one entry per row
+  std::vector<stk::mesh::Entity> orphanNode_;
+  std::vector<stk::mesh::Entity> owningElement_;
+  std::vector<MasterElement *> meSCS_;
+  std::vector<double> bestX_;
+  std::vector<int> elemIsGhosted_;
+
+  // nDim entries per row
+  std::vector<double> isoParCoords_;
+  std::vector<double> nodalCoords_;
+
+  // nodes per donor element entries per row, located by weightOffset_ (size()+1)
+  std::vector<size_t> weightOffset_;
+  std::vector<double> weights_;
+
+  // num_weights(i)+1 entries per row, located by weightOffset_[i]+i
+  std::vector<stk::mesh::Entity> constraintNodes_;
+
+  // rows whose orphan node is locally owned
+  std::vector<size_t> ownedRows_;
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
@@ -18,9 +18,12 @@
 #include <stk_search/IdentProc.hpp>
 #include <stk_search/SearchMethod.hpp>
 
+#include <overset/OversetDonorTable.h>
+
 // STL
 #include <vector>
 #include <map>
+#include <string>
 
 // field types
 typedef stk::mesh::Field<double>  ScalarFieldType;
@@ -43,6 +46,7 @@ namespace stk {
     class MetaData;
     class BulkData;
     class Ghosting;
+    class Selector;
     typedef std::vector<Part*> PartVector;
     struct Entity;
   }
@@ -50,7 +54,6 @@ namespace stk {
 
 namespace sierra {
 namespace nalu{
-class OversetInfo;
 struct OversetUserData;
 
 class OversetManager
@@ -73,6 +76,34 @@ public:
      const int sizeRow,
      const int sizeCol);
 
+  // several fields sharing one ghosting exchange; sizes are per node
+  void overset_orphan_node_field_update(
+     const std::vector<stk::mesh::FieldBase *> &fieldVec,
+     const std::vector<unsigned> &sizeOfFieldVec);
+
+  // interpolate the donor values of an already communicated field to the orphans
+  void interpolate_orphan_field(
+     stk::mesh::FieldBase *theField,
+     const unsigned sizeOfField);
+
+  // save the owned donor of each orphan before a re-initialization
+  void save_previous_donors();
+
+  // release the overset info and search data of a previous initialization
+  void clear_search_data();
+
+  // try the previous donor and its node neighbours; true if one contains the orphan
+  bool warm_start_donor(
+    const size_t i,
+    const stk::mesh::Selector &donorSelector,
+    VectorFieldType *coordinates);
+
+  // isInElement for a candidate donor; keeps it if closer than the current best
+  void evaluate_donor(
+    stk::mesh::Entity elem,
+    const size_t i,
+    VectorFieldType *coordinates);
+
   // initialize ghosting data structures
   void initialize_ghosting();
 
@@ -103,15 +134,21 @@ public:
   // push back on all surfaces that contain the orphan nodes
   void set_orphan_surface_part_vec();
 
-  // create an OversetInfo object for each locally owned exposed node
+  // add a donor table row for each locally owned exposed node
   void create_overset_info_vec();
 
-  // orphan node within element search; product is a valid ghosting and oversetInfoVec completed
+  // orphan node within element search; product is a valid ghosting and donor table completed
   void orphan_node_search();
   
   // set the element variable for intersected elements to unity
   void set_data_on_inactive_part();
 
+  // max/avg over the ranks of the work and time of a search phase
+  void report_imbalance(
+    const std::string &phase,
+    const uint64_t localWork,
+    const double localTime);
+
   // general coarse search method 
   void coarse_search( 
     std::vector<boundingPoint> &boundingPointVec,    
@@ -124,7 +161,8 @@ public:
   // general complete search method (fine search)
   void complete_search( 
     std::vector<std::pair<theKey, theKey> > searchKeyPair,
-    std::map<uint64_t, OversetInfo *> &oversetInfoMap);
+    const size_t beginRow,
+    const size_t endRow);
 
   // data set at construction
   Realm &realm_;
@@ -171,12 +209,18 @@ public:
   stk::mesh::PartVector orphanPointSurfaceVecOverset_;
   stk::mesh::PartVector orphanPointSurfaceVecBackground_;
 
-  // vector of overset information: contains orphan node -> donor element 
-  std::vector<OversetInfo *> oversetInfoVec_;
+  // orphan node -> donor element; the row index is the search ident of the orphan
+  OversetDonorTable donorTable_;
+
+  // rows [0,numOversetOrphans_) are overset orphans, the rest background orphans
+  size_t numOversetOrphans_;
+
+  // orphan node global id to donor element global id of the last search
+  std::map<uint64_t, uint64_t> previousDonorMap_;
 
-  // map of node global id to overset info
-  std::map<uint64_t, OversetInfo *> oversetInfoMapOverset_;
-  std::map<uint64_t, OversetInfo *> oversetInfoMapBackground_;
+  // scratch for evaluate_donor
+  std::vector<double> donorElementCoords_;
+  std::vector<double> donorIsoParCoords_;
 
 };
 
@@ -25,6 +25,8 @@ class Realm;
 class LinearSystem;
 class EquationSystems;
 
+// all ordinate intensities of a node, contiguous and in single precision
+typedef stk::mesh::Field<float, stk::mesh::SimpleArrayTag> OrdinateIntensityFieldType;
 
 class RadiativeTransportEquationSystem : public EquationSystem {
 
@@ -37,6 +39,8 @@ public:
       const bool activateUpwind,
       const bool externalCoupling);
   virtual ~RadiativeTransportEquationSystem();
+
+  virtual void load(const YAML::Node & node);
   
   void register_nodal_fields(
       stk::mesh::Part *part);
@@ -82,11 +86,30 @@ public:
   void assemble_irradiation();
   void normalize_irradiation();
 
+  // sum the ordinate sums of the angular groups (fluxes, irradiation and
+  // solve statistics); see NaluEnv::set_angular_groups
+  void reduce_angular_groups(
+    double &nonLinearResidualSum,
+    double &linearIterationsSum);
+
   void compute_div_norm();
+
+  // subcycling; true when this nonlinear iteration solves the RTE
+  bool solve_this_step();
+
+  // scalar flux of the last solve(s), held or extrapolated in time, with the
+  // emission of the current temperature
+  void compute_subcycled_div();
   
   void copy_ordinate_intensity(
       const ScalarFieldType &fromField,
       const ScalarFieldType &toField);
+
+  // intensity_ to/from the stored intensity of ordinate k
+  void load_ordinate_intensity(
+      const int k);
+  void store_ordinate_intensity(
+      const int k);
   
   void get_current_ordinate_info(
       double &weight,
@@ -109,6 +132,7 @@ public:
   
   ScalarFieldType *intensity_;
   ScalarFieldType *currentIntensity_;
+  OrdinateIntensityFieldType *ordinateIntensity_;
   ScalarFieldType *intensityBc_;
   ScalarFieldType *emissivity_;
   ScalarFieldType *transmissivity_;
@@ -133,6 +157,35 @@ public:
   bool isInit_;
   int ordinateDirections_;
 
+  // ordinates per preconditioner; the first ordinate of each group of this
+  // many (e.g., an octant) builds it and the rest of the group apply it
+  int ordinatesPerPreconditioner_;
+
+  // ordinate intensities in one float field rather than a field per ordinate
+  bool compactIntensityStorage_;
+  int currentOrdinate_;
+
+  // ordinates [ordinateBegin_, ordinateEnd_) solved by this angular group
+  int ordinateBegin_;
+  int ordinateEnd_;
+
+  // node ids last checked to line up over the angular groups, and scratch
+  std::vector<stk::mesh::EntityId> angularCheckedIds_;
+  std::vector<double> angularBuffer_;
+
+  // RTE solved every solveFrequency_ steps, or earlier once the temperature
+  // changes by more than temperatureChangeThreshold_ (relative, max norm)
+  int solveFrequency_;
+  double temperatureChangeThreshold_;
+  bool extrapolateScalarFlux_;
+  int lastSolveStep_;
+  int numSolves_;
+  double lastSolveTime_;
+  double previousSolveTime_;
+  ScalarFieldType *scalarFluxSolve_;
+  ScalarFieldType *scalarFluxPreviousSolve_;
+  ScalarFieldType *temperatureSolve_;
+
   // total set
   std::vector<double> Sn_;
   std::vector<double> weights_;
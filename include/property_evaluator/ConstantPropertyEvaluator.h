@@ -30,6 +30,15 @@ class ConstantPropertyEvaluator : public PropertyEvaluator
   double execute(double *indVarList,
                  stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
+  bool evaluate_device(
+      const DeviceNodeView &indVar,
+      const DeviceNodeView &prop);
+
   double value_;
 
 };
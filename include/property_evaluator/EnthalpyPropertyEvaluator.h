@@ -43,6 +43,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
@@ -68,6 +73,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
@@ -91,6 +101,11 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   double specificHeat_;
   double referenceTemperature_;
 
@@ -112,6 +127,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   // field definition and extraction
   const double referenceTemperature_;
   const size_t cpVecSize_;
@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef FusedPropAlgorithm_h
+#define FusedPropAlgorithm_h
+
+#include <Algorithm.h>
+
+// standard c++
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Part;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+class PropertyEvaluator;
+
+// evaluates several properties on one part in a single pass over the
+// buckets; the independent variables of a bucket are loaded by the first
+// property and are still in cache for the others
+class FusedPropAlgorithm : public Algorithm
+{
+public:
+
+  FusedPropAlgorithm(
+    Realm & realm,
+    stk::mesh::Part * part);
+
+  virtual ~FusedPropAlgorithm() {}
+
+  // indVar is NULL for evaluators without an independent variable
+  void add_property(
+    stk::mesh::FieldBase * prop,
+    PropertyEvaluator *propEvaluator,
+    stk::mesh::FieldBase * indVar);
+
+  size_t num_properties() const { return prop_.size(); }
+
+  virtual void execute();
+
+  std::vector<stk::mesh::FieldBase *> prop_;
+  std::vector<PropertyEvaluator *> propEvaluator_;
+  std::vector<stk::mesh::FieldBase *> indVar_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -10,6 +10,7 @@
 #define GenericPropAlgorithm_h
 
 #include <Algorithm.h>
+#include <DeviceNodeData.h>
 
 namespace stk {
 namespace mesh {
@@ -38,9 +39,15 @@ public:
 
   virtual void execute();
 
+  // evaluator in the Kokkos execution space; false falls back to execute
+  bool execute_device();
+
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
-  
+
+  // node copies for use_device_property_evaluation
+  DeviceNodeData deviceNodes_;
+  DeviceNodeView dProp_;
 };
 
 } // namespace nalu
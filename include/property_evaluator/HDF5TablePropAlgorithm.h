@@ -2,6 +2,8 @@
 #define HDF5TABLEPROPALGORITHM_H
 
 #include <Algorithm.h>
+#include <DeviceNodeData.h>
+#include <FieldTypeDef.h>
 
 #include <vector>
 #include <set>
@@ -53,7 +55,8 @@ public:
     std::string tablePropName,
     std::vector<std::string> &indVarNameVec,
     std::vector<std::string> &indVarTableNameVec,
-    const stk::mesh::MetaData &meta_data);
+    const stk::mesh::MetaData &meta_data,
+    const bool shareOnNode = false);
 
   virtual ~HDF5TablePropAlgorithm();
 
@@ -63,12 +66,33 @@ public:
   const size_t indVarSize_;
 
   std::vector<stk::mesh::FieldBase *> indVar_;
-  std::vector<double *> workIndVar_;
-  std::vector<double> workZ_;
+  std::vector<const double *> workIndVar_;
 
   /** execute Algorithm */
   virtual void execute();
 
+  /** Table query in the Kokkos execution space; false falls back to
+   *  execute().  See HDF5Table::query_batch_device() */
+  bool execute_device();
+
+  /** Serve queries from a uniform resampling of the table; see
+   *  HDF5Table::build_uniform_grid() */
+  void build_uniform_grid( const int numPoints, const double tolerance );
+
+  /** Keep converter results in a node field and re-evaluate a converter
+   *  only where its inputs changed by more than tolerance (relative);
+   *  must be called before the meta data is committed */
+  void enable_converter_cache(
+    const double tolerance,
+    stk::mesh::MetaData &meta_data);
+
+  /** Print the clipping statistics of the table summed over all
+   *  processes; collective */
+  void report_clipping() const;
+
+  /** Bytes held by the table on this process */
+  size_t memory_bytes() const;
+
   /** Get the name of the variable returned by a query to this HDF5TablePropAlgorithm */
   const std::string & name() const { return tablePropName_; }
 
@@ -78,18 +102,24 @@ public:
 
  private:
 
-  // Add the current values to the clipping event log
-  void log_clip_event( const std::vector<double> & values ) const;
-
   //HDF5 file pointer
   H5IO *fileIO_;
 
   //HDF5 table holding for tablePropName_
   HDF5Table *table_;
 
+  // optional per node converter inputs and results; see enable_converter_cache()
+  GenericFieldType *converterCache_;
+  double converterCacheTolerance_;
+
   // Names of the inputs required by the query() function
   std::vector<std::string> inputNames_;
 
+  // node copies for use_device_property_evaluation
+  DeviceNodeData deviceNodes_;
+  DeviceFieldView dIndVar_;
+  DeviceNodeView dProp_;
+
 };
 
 //typedef SharedPtr<const HDF5TablePropAlgorithm> ConstHDF5TablePropAlgorithmPtr;
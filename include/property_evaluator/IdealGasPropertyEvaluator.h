@@ -38,6 +38,15 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
+  bool evaluate_device(
+      const DeviceNodeView &indVar,
+      const DeviceNodeView &prop);
   
   const double pRef_;
   const double R_;
@@ -59,6 +68,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   double compute_mw(
       const double *yk);
@@ -90,6 +104,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   // reference quantities
   const double R_;
 
@@ -116,6 +135,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   double compute_mw(
       const double *yk);
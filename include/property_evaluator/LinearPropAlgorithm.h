@@ -39,6 +39,11 @@ public:
 
   virtual void execute();
 
+  virtual bool field_dependencies(
+    std::vector<stk::mesh::FieldBase *> &reads,
+    std::vector<stk::mesh::FieldBase *> &writes) const {
+    reads.push_back(indVar_); writes.push_back(prop_); return true; }
+
   stk::mesh::FieldBase *prop_;
   stk::mesh::FieldBase *indVar_;
   const double primary_;
@@ -38,6 +38,16 @@ public:
   std::string tablePropName_;
   std::string tableAuxVarName_;
 
+  // optional uniform resampling of the table; zero points uses the spline
+  int tableGridPoints_;
+  double tableGridTolerance_;
+
+  // hold the table once per compute node in shared memory
+  bool tableNodeShared_;
+
+  // relative input change below which converter results are reused; zero disables
+  double tableConverterCacheTolerance_;
+
   // generic property name
   std::string genericPropertyEvaluatorName_;
 
@@ -9,10 +9,14 @@
 #ifndef PropertyEvaluator_h
 #define PropertyEvaluator_h
 
+#include <DeviceTypes.h>
+
 #include <stk_mesh/base/Entity.hpp>
 
 #include <vector>
 
+namespace stk { namespace mesh { class Bucket; } }
+
 namespace sierra{
 namespace nalu{
 
@@ -26,6 +30,19 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
+
+  // bucket form; one virtual call for the b.size() nodes of b. indVarList
+  // holds one value per node, or is NULL if the evaluator takes none
+  virtual void evaluate(
+    const stk::mesh::Bucket &b,
+    const double *indVarList,
+    double *prop);
+
+  // node view form in the Kokkos execution space of the Tpetra node;
+  // false if the evaluator has no device implementation
+  virtual bool evaluate_device(
+    const DeviceNodeView &indVar,
+    const DeviceNodeView &prop) { return false; }
   
 };
 
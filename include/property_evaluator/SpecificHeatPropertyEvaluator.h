@@ -42,6 +42,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   double compute_cp_r(
       const double &T,
@@ -68,6 +73,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   double compute_cp_r(
       const double &T,
       const double *pt_poly);
@@ -91,6 +101,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   // field definition and extraction
   const size_t cpVecSize_;
   GenericFieldType *massFraction_;
@@ -40,6 +40,15 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
+  bool evaluate_device(
+      const DeviceNodeView &indVar,
+      const DeviceNodeView &prop);
   
   double compute_viscosity(
       const double &T,
@@ -48,6 +57,9 @@ public:
   std::vector<double> refMassFraction_;
   std::vector<std::vector<double> > polynomialCoeffs_;
 
+  // yk, muRef, TRef and SRef per species; uploaded on the first device evaluation
+  DeviceNodeView deviceCoeffs_;
+
 };
 
 class SutherlandsYkPropertyEvaluator : public PropertyEvaluator
@@ -64,6 +76,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  virtual void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   virtual double compute_viscosity(
       const double &T,
       const double *pt_poly);
@@ -92,6 +109,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   const double tRef_;
 };
 
@@ -10,6 +10,7 @@
 #define TemperaturePropAlgorithm_h
 
 #include <Algorithm.h>
+#include <DeviceNodeData.h>
 
 // standard c++
 #include <string>
@@ -42,10 +43,17 @@ public:
 
   virtual void execute();
 
+  // evaluator in the Kokkos execution space; false falls back to execute
+  bool execute_device();
+
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
   stk::mesh::FieldBase *temperature_;
-  
+
+  // node copies for use_device_property_evaluation
+  DeviceNodeData deviceNodes_;
+  DeviceNodeView dProp_;
+  DeviceNodeView dTemperature_;
 };
 
 } // namespace nalu
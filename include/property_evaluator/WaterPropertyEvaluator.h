@@ -37,6 +37,11 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -54,6 +59,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   // reference quantities
   const double aw_;
@@ -73,6 +83,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   // reference quantities
   const double aw_;
@@ -94,6 +109,11 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
+
   double compute_h(
     const double T);
 
@@ -118,6 +138,11 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  void evaluate(
+      const stk::mesh::Bucket &b,
+      const double *indVarList,
+      double *prop);
   
   // reference quantities
   const double aw_;
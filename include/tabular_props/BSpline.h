@@ -1,6 +1,7 @@
 #ifndef BSPLINE_H
 #define BSPLINE_H
 
+#include <cstddef>
 #include <vector>
 
 namespace sierra {
@@ -55,6 +56,20 @@ class BSpline{
 
   double value( std::vector<double> & x ) const{ return value( &x[0] ); }
 
+  /**
+   *  Evaluate n points at once.  x[d] holds the n values of independent
+   *  variable d (structure of arrays).  The default evaluates point by point.
+   *
+   *  hint, if given, holds one knot interval per dimension (negative if
+   *  unknown).  It is checked before searching the knot vector and is
+   *  returned holding the interval of the last point, so callers can carry
+   *  it from one batch to the next.
+   */
+  virtual void value_batch( const int n,
+                            const double * const * x,
+                            double * result,
+                            int * hint = NULL ) const;
+
   /**
    *  Read a spline from an HDF5 database.  The file should be opened
    *  and an hdf5 "group" specified.  This spline will be read from the
@@ -69,6 +84,23 @@ class BSpline{
    */
   virtual void write_hdf5( H5IO & io ) const = 0;
 
+  /** Number of doubles written by pack() */
+  virtual size_t pack_size() const = 0;
+
+  /**
+   *  Serialize this spline into buf, which must hold pack_size() doubles.
+   *  Returns the end of the written data.
+   */
+  virtual double * pack( double * buf ) const = 0;
+
+  /**
+   *  Rebuild a skeletal spline from data written by pack().  If shared, the
+   *  knots and control points of the innermost 1-D splines are referenced
+   *  in buf rather than copied, so buf must outlive this spline and must
+   *  not change.  Returns the end of the data that was read.
+   */
+  virtual const double * unpack( const double * buf, const bool shared ) = 0;
+
  protected:
 
   int order_;
@@ -132,6 +164,25 @@ class BSpline1D : public BSpline{
   double value( const double* indepVar ) const;
   inline double value( const double & x ) const{ return value(&x); }
 
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result,
+                    int * hint = NULL ) const;
+
+  /**
+   *  Locate the knot span of n points and evaluate their (order+1) basis
+   *  functions.  shift[k] is the first control point used by point k and
+   *  basis[k*(order+1)+j] the weight of control point shift[k]+j.  Each
+   *  point starts its search from the interval of the previous one; see
+   *  value_batch() for hint.
+   */
+  void basis_batch( const int n,
+                    const double * x,
+                    int * shift,
+                    double * basis,
+                    int * hint = NULL ) const;
+
+  /** The vectors are empty for a spline unpacked as shared; see unpack() */
   inline const std::vector<double> & get_control_pts() const{ return controlPts_; }
   inline       std::vector<double> & get_control_pts()      { return controlPts_; }
   inline const std::vector<double> & get_knot_vector() const{ return knots_; };
@@ -156,6 +207,10 @@ class BSpline1D : public BSpline{
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  size_t pack_size() const;
+  double * pack( double * buf ) const;
+  const double * unpack( const double * buf, const bool shared );
+
   inline bool operator == (const BSpline1D& a ) const{
     return ( a.npts_ == npts_ &&
 	     a.maxIndepVarVal_ == maxIndepVarVal_ &&
@@ -175,9 +230,18 @@ class BSpline1D : public BSpline{
   void compute_control_pts( const std::vector<double> & indepVars,
 			    const std::vector<double> & depVars );
 
+  // point knotsPtr_ and controlPtsPtr_ at the owned vectors
+  void set_owned_views();
+
   int npts_;
   double maxIndepVarVal_, minIndepVarVal_;
   std::vector<double> knots_, controlPts_;
+
+  // knots and control points used for evaluation; either the vectors
+  // above or data shared with other processes
+  const double * knotsPtr_;
+  const double * controlPtsPtr_;
+  int nknots_;
   mutable std::vector<double> basisFun_;
 
   BSpline1D& operator=(const BSpline1D&); // no assignment
@@ -233,9 +297,18 @@ class BSpline2D : public BSpline{
    */
   double value( const double* indepVar ) const;
 
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result,
+                    int * hint = NULL ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  size_t pack_size() const;
+  double * pack( double * buf ) const;
+  const double * unpack( const double * buf, const bool shared );
+
   inline bool operator == (const BSpline2D& a) const{
     bool isEqual = true;
     std::vector<const BSpline1D*>::const_iterator isp  =   dim2Splines_.begin();
@@ -317,9 +390,18 @@ class BSpline3D : public BSpline{
    */
   double value( const double* ) const;
 
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result,
+                    int * hint = NULL ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  size_t pack_size() const;
+  double * pack( double * buf ) const;
+  const double * unpack( const double * buf, const bool shared );
+
   inline bool operator == (const BSpline3D& a) const{
     bool isEqual = true;
     std::vector<const BSpline2D*>::const_iterator isp  = sp2d_.begin();
@@ -405,9 +487,18 @@ class BSpline4D : public BSpline{
    */
   double value( const double* x ) const;
 
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result,
+                    int * hint = NULL ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  size_t pack_size() const;
+  double * pack( double * buf ) const;
+  const double * unpack( const double * buf, const bool shared );
+
   inline bool operator == (const BSpline4D& a) const{
     bool isEqual = true;
     std::vector<const BSpline3D*>::const_iterator isp  = sp3d_.begin();
@@ -496,9 +587,18 @@ class BSpline5D : public BSpline{
    */
   double value( const double* x ) const;
 
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result,
+                    int * hint = NULL ) const;
+
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  size_t pack_size() const;
+  double * pack( double * buf ) const;
+  const double * unpack( const double * buf, const bool shared );
+
   inline bool operator == (const BSpline5D& a) const{
     bool isEqual = true;
     std::vector<const BSpline4D*>::const_iterator isp  = sp4d_.begin();
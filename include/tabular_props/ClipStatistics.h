@@ -0,0 +1,129 @@
+#ifndef CLIPSTATISTICS_H
+#define CLIPSTATISTICS_H
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/**
+ *  @class  ClipStatistics
+ *  @brief  Counters of table queries that fell outside the input bounds
+ *
+ *  For every input the number of queries below and above the bounds, the
+ *  largest exceedance on either side and a histogram of the exceedance
+ *  relative to the input range are kept.  The storage is sized once by
+ *  resize(), so recording never allocates.  Statistics are local to the
+ *  process; reduce() combines them over a communicator when reported, and
+ *  merge() combines those gathered separately (e.g. per thread).
+ */
+class ClipStatistics {
+
+ public:
+
+  /** Histogram bins of the relative exceedance: < 1e-3, < 1e-2, < 1e-1,
+   *  < 1 and >= 1 times the input range */
+  static const int NUM_BINS = 5;
+
+  ClipStatistics() : numClipped_( 0 ) {}
+
+  ~ClipStatistics(){}
+
+  /** Size the counters for dim inputs and clear them */
+  void resize( const size_t dim );
+
+  /** Zero all counters */
+  void clear();
+
+  /** Count input i of a query if value lies outside [min,max]; returns true
+   *  if it does */
+  inline bool record( const size_t i,
+                      const double value,
+                      const double min,
+                      const double max );
+
+  /** Count a query with at least one input out of bounds */
+  void record_point() { ++numClipped_; }
+
+  /** Count n such queries at once, e.g. from a device batch */
+  void record_points( const unsigned long long n ) { numClipped_ += n; }
+
+  /** Add the counters of other, which must have the same dimension */
+  void merge( const ClipStatistics & other );
+
+  /** Sum (counts) and maximize (exceedances) the counters over comm;
+   *  collective */
+  void reduce( MPI_Comm comm );
+
+  /** Print a summary per input that was clipped */
+  void print( std::ostream & out,
+              const std::vector<std::string> & inputNames,
+              const std::vector<double> & inputMin,
+              const std::vector<double> & inputMax ) const;
+
+  /** Number of queries with at least one input out of bounds */
+  unsigned long long num_clipped() const { return numClipped_; }
+
+  size_t dimension() const { return belowCount_.size(); }
+
+  unsigned long long below_count( const size_t i ) const { return belowCount_[i]; }
+  unsigned long long above_count( const size_t i ) const { return aboveCount_[i]; }
+
+  /** Largest distance below the minimum / above the maximum of input i */
+  double max_below( const size_t i ) const { return maxBelow_[i]; }
+  double max_above( const size_t i ) const { return maxAbove_[i]; }
+
+  /** Count of exceedances of input i in histogram bin b */
+  unsigned long long histogram( const size_t i, const int b ) const { return histogram_[i*NUM_BINS+b]; }
+
+ private:
+
+  unsigned long long numClipped_;
+  std::vector<unsigned long long> belowCount_;
+  std::vector<unsigned long long> aboveCount_;
+  std::vector<double> maxBelow_;
+  std::vector<double> maxAbove_;
+  // NUM_BINS entries per input
+  std::vector<unsigned long long> histogram_;
+};
+
+//--------------------------------------------------------------------
+inline bool
+ClipStatistics::record( const size_t i,
+                        const double value,
+                        const double min,
+                        const double max )
+{
+  double excess;
+  if ( value < min ) {
+    excess = min - value;
+    ++belowCount_[i];
+    if ( excess > maxBelow_[i] ) maxBelow_[i] = excess;
+  }
+  else if ( value > max ) {
+    excess = value - max;
+    ++aboveCount_[i];
+    if ( excess > maxAbove_[i] ) maxAbove_[i] = excess;
+  }
+  else {
+    return false;
+  }
+
+  const double range = max - min;
+  const double relative = ( range > 0.0 ) ? excess/range : 1.0;
+  int bin = 0;
+  for ( double edge = 1.e-3; bin < NUM_BINS-1 && relative >= edge; edge *= 10.0 )
+    ++bin;
+  ++histogram_[i*NUM_BINS+bin];
+  return true;
+}
+
+} // end nalu namespace
+} // end sierra namespace
+
+#endif
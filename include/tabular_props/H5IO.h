@@ -2,6 +2,7 @@
 #define H5IO_H
 
 #include <hdf5.h>
+#include <mpi.h>
 
 #include <string>
 #include <vector>
@@ -62,6 +63,13 @@ class H5IO {
 
   void create_file( const std::string & name, int version = 1 ); 
   void open_file( const std::string & name ); 
+
+  /**
+   *  Open for reading on the first process of comm only.  Every read is
+   *  then collective over comm: the first process reads and broadcasts
+   *  the result, so all processes must issue the same sequence of calls.
+   */
+  void open_file( const std::string & name, MPI_Comm comm );
   void close_file();
 
   H5IO create_group( const std::string & name );
@@ -107,11 +115,35 @@ class H5IO {
 
   void read_dataset( const std::string & name, std::vector<double> & value );
 
+  /** True if this process accesses the file */
+  bool is_reader() const { return MPI_COMM_NULL == comm_ || 0 == commRank_; }
+
+  /** True if reads are broadcast from a single reader */
+  bool is_broadcast() const { return MPI_COMM_NULL != comm_; }
+
+  /** Communicator of a broadcast file; MPI_COMM_NULL otherwise */
+  MPI_Comm comm() const { return comm_; }
+
+  /** A copy that reads without broadcasting; for use on the reader only */
+  H5IO independent() const;
+
+  /** Send the reader's value to every process; no-op unless broadcast */
+  void broadcast( int & value ) const;
+  void broadcast( unsigned int & value ) const;
+  void broadcast( double & value ) const;
+  void broadcast( unsigned long long & value ) const;
+  void broadcast( std::string & value ) const;
+  void broadcast( std::vector<int> & value ) const;
+  void broadcast( std::vector<unsigned int> & value ) const;
+  void broadcast( std::vector<double> & value ) const;
+  void broadcast( std::vector<std::string> & value ) const;
+
  private:
   void h5io_create_group( const std::string & name ); 
   void h5io_open_group( const std::string & name ); 
   void h5io_open_group(); 
   void h5io_close_group(); 
+  unsigned int h5io_num_attributes();
   hid_t h5io_create_scalar();
   hid_t h5io_create_1D_array( unsigned int size );
   hid_t h5io_create_attribute( const std::string & name,
@@ -127,6 +159,10 @@ class H5IO {
   hid_t group_;
   int fileVersion_;
 
+  // single reader broadcast; MPI_COMM_NULL if every process reads
+  MPI_Comm comm_;
+  int commRank_;
+
 };
 
 } // end nalu namespace
@@ -1,6 +1,8 @@
 #ifndef HDF5FILEPTR_H
 #define HDF5FILEPTR_H
 
+#include <mpi.h>
+
 #include <vector>
 #include <map>
 #include <string>
@@ -26,9 +28,12 @@ class HDF5FilePtr {
 
   /**
    *  Construct an empty HDF5FilePtr.  It should then be filled with
-   *  Property objects by making repeated calls to add_entry().
+   *  Property objects by making repeated calls to add_entry().  Given a
+   *  communicator, only its first process opens the file and reads are
+   *  broadcast; see H5IO::open_file().
    */
-  explicit HDF5FilePtr( const std::string & fileName = "" );
+  explicit HDF5FilePtr( const std::string & fileName = "",
+                        MPI_Comm comm = MPI_COMM_NULL );
 
   ~HDF5FilePtr();
 
@@ -72,6 +77,9 @@ class HDF5FilePtr {
   /** Pointer to table of properties */
   H5IO *fileIO_;
 
+  /** Communicator for single reader access; MPI_COMM_NULL if none */
+  MPI_Comm comm_;
+
 };
 
 } // end nalu namespace
@@ -1,12 +1,14 @@
 #ifndef HDF5TABLE_H
 #define HDF5TABLE_H
 
+#include <cstddef>
 #include <vector>
-#include <set>
 #include <string>
 #include <map>
 
 #include "tabular_props/H5IO.h"
+#include "tabular_props/ClipStatistics.h"
+#include "tabular_props/UniformGrid.h"
 
 namespace sierra {
 namespace nalu {
@@ -16,23 +18,8 @@ namespace nalu {
 class Converter;
 class H5IO;
 class BSpline;
-
-struct ClipEvent {
-  double severity;
-  std::vector<double> values;
-};
-
-template <class T>
-class ClipEventSortCriterion {
- public:
-  bool operator() ( const T & v1,
-                    const T & v2 ) const {
-    // Sort based on the severity only, in decreasing order
-    return v1.severity > v2.severity;
-  }
-};
-
-typedef std::set<ClipEvent, ClipEventSortCriterion<ClipEvent> > ClipEventLog;
+class UniformGrid;
+class NodeSharedBuffer;
 
 /**
  *  @class  HDF5Table
@@ -59,13 +46,16 @@ class HDF5Table
   HDF5Table();
   /**
    *  Construct an HDF5Table starting with the HDF5 file pointer fileIO
-   *  and calling read_hdf5() method to pull data from disk.
+   *  and calling read_hdf5() method to pull data from disk.  With
+   *  shareOnNode the spline is read by one process per compute node and
+   *  held once per node in shared memory; this is collective.
    */
   HDF5Table(
     H5IO *fileIO,
     std::string tablePropName,
     std::vector<std::string> &indVarNameVec,
-    std::vector<std::string> &indVarTableNameVec);
+    std::vector<std::string> &indVarTableNameVec,
+    const bool shareOnNode = false);
 
   virtual ~HDF5Table();
 
@@ -88,13 +78,43 @@ class HDF5Table
   /**
    *  Return the property value as a function of the provided input variables.
    *  Input bounds clipping of the internal lookup table is enforced, and
-   *  a log of clipped queries is stored.
+   *  clipped queries are counted in clipping_statistics().
    *
    *  @param inputs : Array of independent variable values
    *  @result : The property as a function of the inputs
    */
   double query( const std::vector<double> &inputs ) const;
 
+  /**
+   *  Batched form of query() for n points.  inputs[i] holds the n values of
+   *  input i, in the order of input_names(); the same clipping and counting
+   *  is applied as in query(), and the interpolation is done in a single
+   *  call to the internal table.
+   *
+   *  @param n : Number of points
+   *  @param inputs : One array of n values per input variable
+   *  @param outputs : The n property values
+   */
+  void query_batch( const int n,
+                    const std::vector<const double *> &inputs,
+                    double *outputs ) const;
+
+  /**
+   *  Batched query that remembers, per point, the inputs and result of each
+   *  Converter in converterCache (converter_cache_size() values per point,
+   *  zero initialized).  A Converter is re-evaluated only if one of its
+   *  inputs changed by more than cacheTolerance relative to the cached one.
+   */
+  void query_batch( const int n,
+                    const std::vector<const double *> &inputs,
+                    double *outputs,
+                    double *converterCache,
+                    const double cacheTolerance ) const;
+
+  /** Number of values per point in the cache taken by query_batch();
+   *  zero if there are no converters */
+  unsigned int converter_cache_size() const;
+
   /**
    *  Return the property value as a function of the provided input variables.
    *  WARNING: No input bounds clipping is enforced, and no logs are stored
@@ -106,19 +126,38 @@ class HDF5Table
    */
   double raw_query( const std::vector<double> &inputs ) const;
 
-  /** Set the number of clipping events we want to log */
-  void set_clipping_log_size( unsigned int size ) ;
+  /**
+   *  Resample the table onto a uniform grid (in the log space of any log
+   *  scaled input) that query() and query_batch() then interpolate
+   *  multilinearly.  Starting from numPoints per dimension, the spacing is
+   *  halved until the error at the cell centers is below tolerance times
+   *  the range of the property.  If the grid would become too large the
+   *  spline is kept.  raw_query() always uses the spline.
+   */
+  void build_uniform_grid( const int numPoints, const double tolerance );
+
+  /** True if queries are served from the resampled grid */
+  bool has_uniform_grid() const { return NULL != grid_; }
+
+  /**
+   *  query_batch() in the Kokkos execution space of the Tpetra node for a
+   *  table with a uniform grid and no converters; inputs is (point,
+   *  input) in the order of input_names().  The grid is uploaded on the
+   *  first call.  Clipped points are counted, the per input exceedances
+   *  are not.  Returns false if the table does not qualify.
+   */
+  bool query_batch_device( const DeviceFieldView &inputs,
+                           const DeviceNodeView &outputs ) const;
 
   /** Return the current count of clipping events that have occurred */
   unsigned int num_clipping_events() const;
 
-  /** Return the buffer of input coordinates that resulted in a clipping
-   *  event
-   */
-  const ClipEventLog & clipping_event_log() const;
+  /** Return the clipping counters of this process since the last
+   *  clear_clipping_log() */
+  const ClipStatistics & clipping_statistics() const { return clipStats_; }
 
-  /** Return the list of input variables corresponding to the values in
-   *  the clipping event log.  This is essentially the inputs to the
+  /** Return the list of input variables corresponding to the counters in
+   *  the clipping statistics.  This is essentially the inputs to the
    *  internal interpolation table.
    */
   const std::vector<std::string> & clipping_event_input_names() const { return inputNames_; }
@@ -129,9 +168,17 @@ class HDF5Table
   /** Return the list of maximum internal clipping bounds */
   const std::vector<double> & clipping_event_max_bounds() const;
 
-  /** Reset the internal clipping event logging */
+  /** Reset the internal clipping statistics */
   void clear_clipping_log() ;
 
+  /** Reduce the clipping statistics over comm and print them on P0 if
+   *  any query was clipped; collective.  The local counters are kept. */
+  void report_clipping( MPI_Comm comm ) const;
+
+  /** Bytes held by the spline, the mesh points and the optional uniform
+   *  grid on this process; a node-shared spline is charged to the node root */
+  size_t memory_bytes() const;
+
   /** Return the number of Converters.  If the number is zero, then the
    *  inputs to the HDF5Table will match the inputs to the internal Table,
    *  and the Table can be queried for overall HDF5Table configuration like
@@ -152,14 +199,14 @@ class HDF5Table
 
  private:
 
-  // Add the current values to the clipping event log
-  void log_clip_event( const std::vector<double> & values ) const;
-
   /** Rewire the inputs and outputs of the Table and any optional Converters
    *  so that they talk to each other properly and inputs to the HDF5Table will
    *  be sent to the correct object. */
   void update_input_mapping();
 
+  /** Construct an empty spline of the table dimension */
+  BSpline * create_spline() const;
+
   /** Return the index correspondig to the variable name in nameVector */
   int findix( const std::vector<std::string> & nameVector,
 	      const std::string & name );
@@ -228,10 +275,26 @@ class HDF5Table
   // Internal interpolator used to perform table lookups
   BSpline * spline_;
 
-  // Buffers for storing clipping diagnostic information
-  mutable unsigned int clipEventLogSize_;
-  mutable unsigned int numClipped_;
-  mutable ClipEventLog clipEventLog_;
+  // Optional uniform resampling of spline_; owned
+  UniformGrid * grid_;
+
+  // Device copies of grid_, the input map and the clipping bounds (min,
+  // max and log scale flag per dimension); uploaded by query_batch_device()
+  mutable DeviceUniformGrid deviceGrid_;
+  mutable Kokkos::View<int*, DeviceType> deviceIndex_;
+  mutable Kokkos::View<double*, DeviceType> deviceBounds_;
+  mutable bool deviceUploaded_;
+
+  // Node-shared storage of the spline data; NULL if held per process
+  NodeSharedBuffer * sharedBuffer_;
+
+  // Huge page backed storage of a per process spline (see HugePages.h);
+  // NULL unless huge pages are active. Size in doubles
+  double * hugeBuffer_;
+  size_t hugeBufferSize_;
+
+  // Counters of out of bounds queries; sized once the inputs are known
+  mutable ClipStatistics clipStats_;
 
   // delete this and use lookupBuf_ instead
   //  double * tableBuf_;
@@ -243,6 +306,13 @@ class HDF5Table
   // Scratch space for doing bounds clipping on lookupBuffer_
   mutable std::vector<double> lookupBufferChecked_;
 
+  // Scratch space for query_batch(); dimension_ arrays of the batch size
+  mutable std::vector<double> batchBuffer_;
+  mutable std::vector<const double *> batchBufferPtr_;
+  // Knot interval of the last batched point per dimension; consecutive
+  // batches are usually neighbouring nodes, so it is kept between calls
+  mutable std::vector<int> batchHint_;
+
 };
 
 //typedef SharedPtr<const HDF5Table> ConstHDF5TablePtr;
@@ -11,17 +11,22 @@ namespace nalu {
  *  @author James C. Sutherland
  *  @date   November, 2005
  *
- *  @brief Supports LU-decompositon for a matrix.
+ *  @brief Supports LU-decompositon for a banded matrix.
+ *
+ *  Entries more than bandwidth off the diagonal are zero.  Only the band
+ *  is stored and the factorization (without pivoting, as suits B-spline
+ *  collocation matrices) keeps to it, so both scale with dim*bandwidth.
  */
 class LU{
  public:
   LU( const int dim, const int bandwidth );
   ~LU();
 
-  // Writable element access
+  // Writable element access; within the band only
   inline double & operator()( int row, int col ) {
     ThrowRequire( row <= dim_ );
     ThrowRequire( col <= dim_ );
+    ThrowRequire( AA_.in_band(row,col) );
     isReady_ = false;
     return AA_(row,col);
   };
@@ -30,7 +35,7 @@ class LU{
   inline double operator()( int row, int col ) const {
     ThrowRequire( row <= dim_ );
     ThrowRequire( col <= dim_ );
-    return AA_(row,col);
+    return AA_.in_band(row,col) ? AA_(row,col) : 0.0;
   };
 
   // Read-only element access that works.  Compiler refuses to use
@@ -38,7 +43,7 @@ class LU{
   inline double value( int row, int col ) const {
     ThrowRequire( row <= dim_ );
     ThrowRequire( col <= dim_ );
-    return AA_(row,col);
+    return AA_.in_band(row,col) ? AA_(row,col) : 0.0;
   };
 
   // perform the LU-factorization
@@ -60,23 +65,28 @@ class LU{
     SparseMatrix( const int dim, const int bandwidth );
     ~SparseMatrix();
 
+    inline bool in_band( int row, int col ) const {
+      return col - row <= band_ && row - col <= band_;
+    };
+
     // Writable element access
     inline double & operator()( int row, int col ) {
-      return AA_[row][col];
+      return AA_[row*width_ + col - row + band_];
     };
 
     // Read-only element access
     inline double operator()( int row, int col ) const {
-      return AA_[row][col];
+      return AA_[row*width_ + col - row + band_];
     };
 
-    void dump();
+    int bandwidth() const{ return band_; }
 
   private:
     SparseMatrix();
 
-    double **AA_;
-    const int dim_, band_;
+    // row i holds columns i-band_ .. i+band_
+    double *AA_;
+    const int dim_, band_, width_;
   };
 
   const int dim_;
@@ -0,0 +1,63 @@
+#ifndef NODESHAREDBUFFER_H
+#define NODESHAREDBUFFER_H
+
+#include <mpi.h>
+
+#include <cstddef>
+
+namespace sierra {
+namespace nalu {
+
+/**
+ *  @class  NodeSharedBuffer
+ *  @brief  Read-only array shared by all processes of a compute node
+ *
+ *  The array lives in an MPI-3 shared memory window.  One process per node
+ *  (the node root) fills it; all others on the node read the same memory.
+ *  Construction, allocate(), fence() and destruction are collective over
+ *  the communicator passed to the constructor.
+ */
+class NodeSharedBuffer {
+
+ public:
+
+  explicit NodeSharedBuffer( MPI_Comm comm );
+
+  ~NodeSharedBuffer();
+
+  /** True on the one process per node that fills the buffer */
+  bool is_node_root() const { return 0 == nodeRank_; }
+
+  /**
+   *  Allocate the buffer; only the size given on the node root is used.
+   *  Returns the start of the shared array on every process.
+   */
+  double * allocate( size_t size );
+
+  /**
+   *  Copy the buffer of the first node root (rank 0 of the communicator)
+   *  to the buffers of all other nodes; size is the number of doubles.
+   *  Follow with fence().
+   */
+  void broadcast_from_first_node( size_t size );
+
+  /** Make the contents written by the node root visible on the node */
+  void fence();
+
+ private:
+
+  NodeSharedBuffer( const NodeSharedBuffer & );            // no copying
+  NodeSharedBuffer operator=( const NodeSharedBuffer & );  // no assignment
+
+  MPI_Comm nodeComm_;
+  MPI_Comm leaderComm_; // node roots only
+  int nodeRank_;
+  MPI_Win window_;
+  bool hasWindow_;
+  double * data_;
+};
+
+} // end nalu namespace
+} // end sierra namespace
+
+#endif
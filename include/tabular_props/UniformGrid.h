@@ -0,0 +1,139 @@
+#ifndef UNIFORMGRID_H
+#define UNIFORMGRID_H
+
+#include <DeviceTypes.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+// Forward declarations
+class BSpline;
+
+//====================================================================
+//====================================================================
+
+/**
+ *  @struct DeviceUniformGrid
+ *  @brief Copy of a UniformGrid in the Kokkos execution space of the
+ *         Tpetra node; see UniformGrid::device_copy()
+ */
+struct DeviceUniformGrid{
+
+  static const int maxDim = 8;
+
+  int dim_;
+  Kokkos::View<double*, DeviceType> lo_;
+  Kokkos::View<double*, DeviceType> invDx_;
+  Kokkos::View<int*, DeviceType> points_;
+  Kokkos::View<size_t*, DeviceType> stride_;
+  Kokkos::View<double*, DeviceType> values_;
+
+  /** Same interpolation as UniformGrid::value() */
+  KOKKOS_INLINE_FUNCTION
+  double value( const double * x ) const
+  {
+    size_t base = 0;
+    double t[maxDim];
+    for ( int d = 0; d < dim_; ++d ) {
+      const double s = (x[d]-lo_(d))*invDx_(d);
+      int i = (int)floor(s);
+      i = i < 0 ? 0 : i;
+      i = i > points_(d)-2 ? points_(d)-2 : i;
+      double w = s-i;
+      t[d] = w < 0.0 ? 0.0 : (w > 1.0 ? 1.0 : w);
+      base += i*stride_(d);
+    }
+    double result = 0.0;
+    const int numCorners = 1 << dim_;
+    for ( int c = 0; c < numCorners; ++c ) {
+      double w = 1.0;
+      size_t offset = base;
+      for ( int d = 0; d < dim_; ++d ) {
+        if ( (c >> d) & 1 ) {
+          w *= t[d];
+          offset += stride_(d);
+        }
+        else {
+          w *= 1.0-t[d];
+        }
+      }
+      result += w*values_(offset);
+    }
+    return result;
+  }
+};
+
+//====================================================================
+//====================================================================
+
+/**
+ *  @class UniformGrid
+ *  @brief Multilinear interpolant on a uniform grid
+ *
+ *  A tabulated copy of a BSpline on a uniform grid spanning [lo,hi] in
+ *  each dimension.  Locating the cell of a query is O(1), so evaluation
+ *  is much cheaper than the full spline at the cost of memory and a
+ *  (checked) interpolation error.
+ */
+class UniformGrid{
+
+ public:
+
+  /**
+   *  @param lo : lower bound of each dimension
+   *  @param hi : upper bound of each dimension
+   *  @param points : number of grid points in each dimension (at least 2)
+   */
+  UniformGrid( const std::vector<double> & lo,
+               const std::vector<double> & hi,
+               const std::vector<int> & points );
+
+  ~UniformGrid(){}
+
+  /** Number of grid points over all dimensions */
+  static size_t total_points( const std::vector<int> & points );
+
+  /** Fill the grid values by evaluating the spline at every grid point */
+  void sample( const BSpline & spline );
+
+  /**
+   *  Largest absolute difference between the grid and the spline at the
+   *  cell centers, where multilinear interpolation is least accurate.
+   */
+  double max_error( const BSpline & spline ) const;
+
+  /** Interpolate at a point inside [lo,hi]; the ordering is [x1,x2,...] */
+  double value( const double * x ) const;
+
+  /** Interpolate n points; x[d] holds the n values of dimension d */
+  void value_batch( const int n,
+                    const double * const * x,
+                    double * result ) const;
+
+  /** Upload the grid to the Kokkos execution space of the Tpetra node */
+  DeviceUniformGrid device_copy() const;
+
+  int get_dimension() const{ return dim_; }
+  const std::vector<int> & get_points() const{ return points_; }
+
+ private:
+
+  // locate the cell in dimension d and the weight of its upper node
+  inline void locate( const int d, const double x, int & i, double & t ) const;
+
+  const int dim_;
+  std::vector<double> lo_;
+  std::vector<double> dx_;
+  std::vector<double> invDx_;
+  std::vector<int> points_;
+  std::vector<size_t> stride_;
+  std::vector<double> values_;
+};
+
+} // end nalu namespace
+} // end sierra namespace
+
+#endif
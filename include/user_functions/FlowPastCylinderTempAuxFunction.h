@@ -21,6 +21,8 @@ public:
   FlowPastCylinderTempAuxFunction();
 
   virtual ~FlowPastCylinderTempAuxFunction() {}
+
+  virtual bool is_time_dependent() const { return false; }
   
   virtual void do_evaluate(
     const double * coords,
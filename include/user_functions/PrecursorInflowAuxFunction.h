@@ -0,0 +1,77 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PrecursorInflowAuxFunction_h
+#define PrecursorInflowAuxFunction_h
+
+#include <AuxFunction.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+// inflow from the plane samples of a precursor run (data_probes planes)
+class PrecursorInflowAuxFunction : public AuxFunction
+{
+public:
+
+  PrecursorInflowAuxFunction(
+    const unsigned beginPos,
+    const unsigned endPos,
+    const std::string &fileName,
+    const std::string &fieldName,
+    std::vector<double> theParams);
+
+  virtual ~PrecursorInflowAuxFunction();
+
+  virtual void do_evaluate(
+    const double * coords,
+    const double time,
+    const unsigned spatialDimension,
+    const unsigned numPoints,
+    double * fieldPtr,
+    const unsigned fieldSize,
+    const unsigned beginPos,
+    const unsigned endPos) const;
+
+private:
+
+  double record_time(const size_t record) const;
+  double record_value(const size_t record, const size_t point, const unsigned comp) const;
+
+  const std::string fileName_;
+
+  // file mapped once; the page cache serves every later read
+  const char *mappedData_;
+  size_t mappedSize_;
+
+  // plane geometry and layout of the records
+  int nDim_;
+  int numOne_;
+  int numTwo_;
+  double corner_[3];
+  double edgeOne_[3];
+  double edgeTwo_[3];
+  size_t headerSize_;
+  size_t recordSize_;
+  size_t numRecords_;
+  size_t pointStride_;
+  size_t fieldOffset_;
+  unsigned fieldSize_;
+
+  // precursor time = simulation time + timeOffset_
+  double timeOffset_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -22,6 +22,8 @@ public:
   SteadyTaylorVortexPressureAuxFunction();
 
   virtual ~SteadyTaylorVortexPressureAuxFunction() {}
+
+  virtual bool is_time_dependent() const { return false; }
   
   virtual void do_evaluate(
     const double * coords,
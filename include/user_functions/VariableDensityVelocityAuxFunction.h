@@ -24,6 +24,8 @@ public:
     const unsigned endPos);
 
   virtual ~VariableDensityVelocityAuxFunction() {}
+
+  virtual bool is_time_dependent() const { return false; }
   
   virtual void do_evaluate(
     const double * coords,
@@ -153,58 +153,81 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::apply
   stk::mesh::BulkData         &toBulkData = ToPoints.toBulkData_;
   Realm &fromRealm = FromElem.fromRealm_;
 
-  typename EntityKeyMap::const_iterator ii;
-  for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
+  // resolve the entities, master elements and weights once; neither realm
+  // moves between searches, so only a mesh modification invalidates them
+  if ( !ToPoints.cacheIsValid_
+       || ToPoints.cacheFromSyncCount_ != fromBulkData.synchronized_count()
+       || ToPoints.cacheToSyncCount_ != toBulkData.synchronized_count() ) {
+
+    ToPoints.cacheToNode_.clear();
+    ToPoints.cacheFromElem_.clear();
+    ToPoints.cacheWeightOffset_.assign(1, 0);
+    ToPoints.cacheWeights_.clear();
+
+    typename EntityKeyMap::const_iterator ii;
+    for(ii=RangeToDomain.begin(); ii!=RangeToDomain.end(); ++ii ) { 
     
-    const stk::mesh::EntityKey thePt  = ii->first;
-    const stk::mesh::EntityKey theBox = ii->second; 
+      const stk::mesh::EntityKey thePt  = ii->first;
+      const stk::mesh::EntityKey theBox = ii->second; 
     
-    if (1 != ToPoints.TransferInfo_.count(thePt)) {
-      if (0 == ToPoints.TransferInfo_.count(thePt)) 
-        throw std::runtime_error("Key not found in database");
-      else  
-        throw std::runtime_error("Too many Keys found in database");
+      if (1 != ToPoints.TransferInfo_.count(thePt)) {
+        if (0 == ToPoints.TransferInfo_.count(thePt)) 
+          throw std::runtime_error("Key not found in database");
+        else  
+          throw std::runtime_error("Too many Keys found in database");
+      }
+      const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
+      stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
+      stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
+
+      const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
+      const stk::topology &theElemTopo = theBucket.topology();
+      MasterElement *meSCS = fromRealm.get_surface_master_element(theElemTopo);
+      const int nodesPerElement = meSCS->nodesPerElement_;
+
+      const size_t offSet = ToPoints.cacheWeights_.size();
+      ToPoints.cacheWeights_.resize(offSet + nodesPerElement);
+      meSCS->general_shape_fcn(1, &isoParCoords_[0], &ToPoints.cacheWeights_[offSet]);
+
+      ToPoints.cacheToNode_.push_back(theNode);
+      ToPoints.cacheFromElem_.push_back(theElem);
+      ToPoints.cacheWeightOffset_.push_back(ToPoints.cacheWeights_.size());
     }
-    const std::vector<double> &isoParCoords_ = ToPoints.TransferInfo_[thePt];
-    stk::mesh::Entity theNode =   toBulkData.get_entity(thePt);
-    stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
 
-    const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
-    const stk::topology &theElemTopo = theBucket.topology();
-    MasterElement *meSCS = fromRealm.get_surface_master_element(theElemTopo);
+    ToPoints.cacheFromSyncCount_ = fromBulkData.synchronized_count();
+    ToPoints.cacheToSyncCount_ = toBulkData.synchronized_count();
+    ToPoints.cacheIsValid_ = true;
+  }
+
+  const size_t numRows = ToPoints.cacheToNode_.size();
+  for ( size_t i = 0; i < numRows; ++i ) {
 
-    stk::mesh::Entity const* elem_node_rels = fromBulkData.begin_nodes(theElem);
-    const int num_nodes = fromBulkData.num_nodes(theElem);
-    const int nodesPerElement = meSCS->nodesPerElement_;
+    stk::mesh::Entity theNode = ToPoints.cacheToNode_[i];
+    stk::mesh::Entity const* elem_node_rels = fromBulkData.begin_nodes(ToPoints.cacheFromElem_[i]);
+    const double *weights = &ToPoints.cacheWeights_[ToPoints.cacheWeightOffset_[i]];
+    const int num_nodes = ToPoints.cacheWeightOffset_[i+1] - ToPoints.cacheWeightOffset_[i];
 
     for (unsigned n=0; n!=FromElem.fromFieldVec_.size(); ++n) {
 
       // extract field
       const stk::mesh::FieldBase *toFieldBaseField = ToPoints.toFieldVec_[n];
+      const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
 
       // FixMe: integers are problematic for now...
       const size_t sizeOfField = field_bytes_per_entity(*toFieldBaseField, theNode) / sizeof(double);
-      std::vector <double > Coeff(nodesPerElement*sizeOfField);
-
-      // now load the elemental values for future interpolation; fill in connected nodes
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
-
-        const stk::mesh::FieldBase *fromFieldBaseField = FromElem.fromFieldVec_[n];
-        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, node );
-
-        for ( size_t j = 0; j < sizeOfField; ++j) {
-          const int offSet = j*nodesPerElement + ni; 
-          Coeff[offSet] = theField[j];
-        }   
-      }
 
       double * toField = (double*)stk::mesh::field_data(*toFieldBaseField, theNode);
       if (!toField) throw std::runtime_error("Receiving field undefined on mesh object.");
-      meSCS->interpolatePoint(sizeOfField,
-                              &isoParCoords_[0],
-                              &Coeff[0],
-                              toField);
+
+      // weighted sum of the connected nodes
+      for ( size_t j = 0; j < sizeOfField; ++j)
+        toField[j] = 0.0;
+      for ( int ni = 0; ni < num_nodes; ++ni ) { 
+        const double *theField = (double*)stk::mesh::field_data(*fromFieldBaseField, elem_node_rels[ni] );
+        const double w = weights[ni];
+        for ( size_t j = 0; j < sizeOfField; ++j)
+          toField[j] += w*theField[j];
+      }
     }   
   }
 }
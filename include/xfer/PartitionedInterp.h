@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PartitionedInterp_h
+#define PartitionedInterp_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <mpi.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+// interpolation of nodal fields onto the owned nodes of the to parts without
+// ghosting the from mesh; the points travel to the ranks that own the from
+// elements and the interpolated values travel back. The from elements of
+// each rank are held in a bounding volume tree; its top boxes (spatial
+// partitions of the rank) are known to all ranks and route the points, the
+// tree itself serves the point location on the owning rank. The realms may
+// run on different processes of comm (concurrent realms); a rank takes the
+// from side, the to side or both as it holds the realms
+class PartitionedInterp
+{
+public:
+
+  PartitionedInterp(
+    Realm &fromRealm,
+    Realm &toRealm,
+    const stk::mesh::PartVector &fromPartVec,
+    const stk::mesh::PartVector &toPartVec,
+    const std::vector<std::pair<std::string, std::string> > &varPairName,
+    const double tolerance,
+    const int numPartitions,
+    MPI_Comm comm);
+  ~PartitionedInterp();
+
+  // collective over comm
+  void execute();
+
+private:
+
+  struct TreeNode {
+    double min_[3];
+    double max_[3];
+    int child_[2]; // -1 for a leaf
+    size_t begin_; // range of elemOrder_
+    size_t end_;
+  };
+
+  void build_tree();
+  int build_node(const size_t begin, const size_t end);
+
+  // boxes of the tree nodes numPartitions_ wide; empty boxes pad the rest
+  void partition_boxes(std::vector<double> &boxes) const;
+
+  // elements whose box, widened by the tolerance, holds the point
+  void find_candidates(const double *point, std::vector<size_t> &candidates) const;
+  size_t find_nearest(const double *point) const;
+
+  // normalized distance of the point to the best element (max when none)
+  // and the field values interpolated there
+  double interpolate(const double *point, double *values) const;
+
+  Realm &fromRealm_;
+  Realm &toRealm_;
+  const stk::mesh::PartVector fromPartVec_;
+  const stk::mesh::PartVector toPartVec_;
+  const double tolerance_;
+  const int numPartitions_;
+  const MPI_Comm comm_;
+  int nDim_;
+
+  std::vector<const stk::mesh::FieldBase *> fromFieldVec_;
+  std::vector<const stk::mesh::FieldBase *> toFieldVec_;
+  std::vector<size_t> fieldStride_; // doubles per node of each from field
+  size_t valueStride_;
+
+  // owned from elements; [min, max] box of each, 6 doubles
+  std::vector<stk::mesh::Entity> elems_;
+  std::vector<double> elemBox_;
+  std::vector<size_t> elemOrder_;
+  std::vector<TreeNode> tree_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -122,7 +122,10 @@ public :
     toPartVec_(toPartVec),
     toFieldVec_   (get_fields(toMetaData, VarPairName)),
     comm_(comm),
-    radius_(radius)   
+    radius_(radius),
+    cacheIsValid_(false),
+    cacheFromSyncCount_(0),
+    cacheToSyncCount_(0)
     {
       // nothing to do
     }
@@ -196,6 +199,16 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // interpolation rows resolved by the first apply: point, donor element and
+  // donor shape function weights; reused until either bulk data is modified
+  bool cacheIsValid_;
+  size_t cacheFromSyncCount_;
+  size_t cacheToSyncCount_;
+  std::vector<stk::mesh::Entity> cacheToNode_;
+  std::vector<stk::mesh::Entity> cacheFromElem_;
+  std::vector<size_t> cacheWeightOffset_;
+  std::vector<double> cacheWeights_;
+
 };
 
 } // namespace nalu
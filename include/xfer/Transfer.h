@@ -33,6 +33,7 @@ namespace nalu{
 
 class Realm;
 class Transfers;
+class PartitionedInterp;
 class Simulation;
 
 class Transfer
@@ -55,6 +56,8 @@ public:
 
   Transfers &transfers_;
   boost::shared_ptr<stk::transfer::TransferBase> transfer_;
+  // search_method partitioned (initialization only); replaces transfer_
+  boost::shared_ptr<PartitionedInterp> partitionedInterp_;
 
   bool couplingPhysicsSpecified_;
   bool transferVariablesSpecified_;
@@ -63,6 +66,10 @@ public:
   Realm * fromRealm_;
   Realm * toRealm_;
 
+  // the realms run on different processor ranges and advance side by side;
+  // executed by all processes at the Transfers sync points
+  bool concurrent_;
+
   // during load
   std::string name_;
   std::string transferType_;
@@ -70,6 +77,7 @@ public:
   std::string searchMethodName_;
   double searchTolerance_;
   double searchExpansionFactor_;
+  int searchPartitions_;
   std::pair<std::string, std::string> realmPairName_;
   
   // allow the user to provide a vector "from" and "to" parts; names
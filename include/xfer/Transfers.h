@@ -36,11 +36,15 @@ public:
   void load(const YAML::Node & node);
   void breadboard();
   void initialize();
+  // transfers between realms on different processor ranges; collective
+  // over all processes
+  void execute_concurrent(const std::string &objective);
   Simulation *root();
   Simulation *parent();
 
   Simulation &simulation_;
   std::vector<Transfer *> transferVector_;
+  std::vector<Transfer *> concurrentTransferVec_;
 };
 
 } // namespace nalu